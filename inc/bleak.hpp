@@ -3,11 +3,14 @@
 // IWYU pragma: begin_exports
 #include <bleak/applicator.hpp>
 #include <bleak/arc.hpp>
+#include <bleak/archive.hpp>
 #include <bleak/area.hpp>
 #include <bleak/array.hpp>
 #include <bleak/atlas.hpp>
 #include <bleak/binarray.hpp>
+#include <bleak/bitplane.hpp>
 #include <bleak/bitdef.hpp>
+#include <bleak/bucket_queue.hpp>
 #include <bleak/camera.hpp>
 #include <bleak/cardinal.hpp>
 #include <bleak/circle.hpp>
@@ -18,6 +21,8 @@
 #include <bleak/constants.hpp>
 #include <bleak/creeper.hpp>
 #include <bleak/cursor.hpp>
+#include <bleak/delta.hpp>
+#include <bleak/dirty_zone.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/field.hpp>
 #include <bleak/glyph.hpp>
@@ -26,6 +31,7 @@
 #include <bleak/iter.hpp>
 #include <bleak/keyboard.hpp>
 #include <bleak/keyframe.hpp>
+#include <bleak/layout.hpp>
 #include <bleak/leaf.hpp>
 #include <bleak/line.hpp>
 #include <bleak/log.hpp>
@@ -33,10 +39,13 @@
 #include <bleak/memory.hpp>
 #include <bleak/mixer.hpp>
 #include <bleak/mouse.hpp>
+#include <bleak/multi_field.hpp>
 #include <bleak/music.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/padded_array.hpp>
 #include <bleak/path.hpp>
+#include <bleak/ping_pong_zone.hpp>
 #include <bleak/primitive_types.hpp>
 #include <bleak/primitive.hpp>
 #include <bleak/priority_mutex.hpp>
@@ -46,14 +55,22 @@
 #include <bleak/region.hpp>
 #include <bleak/renderer.hpp>
 #include <bleak/saturate.hpp>
+#include <bleak/sightline.hpp>
+#include <bleak/simd.hpp>
 #include <bleak/sound.hpp>
 #include <bleak/sparse.hpp>
 #include <bleak/sprite.hpp>
+#include <bleak/spsc_queue.hpp>
 #include <bleak/steam.hpp>
+#include <bleak/stencil.hpp>
+#include <bleak/storage.hpp>
+#include <bleak/streaming_region.hpp>
 #include <bleak/subsystem.hpp>
 #include <bleak/text.hpp>
 #include <bleak/texture.hpp>
+#include <bleak/thread_pool.hpp>
 #include <bleak/timer.hpp>
+#include <bleak/tracked_zone.hpp>
 #include <bleak/tree.hpp>
 #include <bleak/triangle.hpp>
 #include <bleak/typedef.hpp>
@@ -62,4 +79,5 @@
 #include <bleak/wave.hpp>
 #include <bleak/window.hpp>
 #include <bleak/zone.hpp>
+#include <bleak/zone_view.hpp>
 // IWYU pragma: end_exports
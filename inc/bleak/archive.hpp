@@ -0,0 +1,376 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <bleak/delta.hpp>
+#include <bleak/log.hpp>
+#include <bleak/simd.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	namespace archive {
+		// a file is a header, an index with one entry per chunk and then the compressed chunks; fields are stored in native byte order
+		constexpr u32 magic{ 0x5A4B4C42 };
+		constexpr u16 version{ 1 };
+
+		struct header_t {
+			u32 magic;
+			u16 version;
+			u16 reserved;
+			u64 chunk_count;
+			u64 chunk_size;
+			u64 type_hash;
+			u64 index_checksum;
+		};
+
+		struct entry_t {
+			u64 offset;
+			u64 length;
+			u64 checksum;
+		};
+
+		inline bool is_archive(cref<std::string> path) noexcept {
+			std::ifstream file{ path, std::ios::in | std::ios::binary };
+
+			u32 identifier{ 0 };
+
+			return file.read(reinterpret_cast<str>(&identifier), sizeof(identifier)) && identifier == magic;
+		}
+
+		// identifies the type a chunk was written from; the name is as spelled by the compiler, so files are only portable between builds of the same toolchain
+		template<typename T> constexpr u64 type_hash() noexcept {
+			const std::string_view name{ std::source_location::current().function_name() };
+
+			u64 hash{ 0xCBF29CE484222325 };
+
+			for (cauto character : name) {
+				hash = (hash ^ static_cast<u8>(character)) * 0x100000001B3;
+			}
+
+			return (hash ^ sizeof(T)) * 0x100000001B3;
+		}
+
+		// four independent multiply-rotate lanes over eight byte words, folded together with the tail and the length
+		inline u64 checksum(cptr<u8> data, usize count) noexcept {
+			constexpr u64 prime{ 0x9E3779B97F4A7C15 };
+
+			u64 lanes[4]{ prime, prime ^ 1, prime ^ 2, prime ^ 3 };
+
+			usize i{ 0 };
+
+			for (; i + 32 <= count; i += 32) {
+				for (usize lane{ 0 }; lane < 4; ++lane) {
+					u64 word;
+					std::memcpy(&word, data + i + lane * 8, sizeof(word));
+
+					lanes[lane] = std::rotl(lanes[lane] ^ (word * prime), 31) * prime;
+				}
+			}
+
+			u64 hash{ std::rotl(lanes[0], 1) ^ std::rotl(lanes[1], 7) ^ std::rotl(lanes[2], 12) ^ std::rotl(lanes[3], 18) };
+
+			for (; i < count; ++i) {
+				hash = (hash ^ data[i]) * prime;
+			}
+
+			hash ^= count;
+			hash ^= hash >> 33;
+			hash *= prime;
+			hash ^= hash >> 29;
+
+			return hash;
+		}
+
+		// a control byte below 0x80 introduces one to 128 literal bytes; otherwise its low seven bits hold the match length less the minimum, extended by a varint when saturated, and a varint distance follows
+		constexpr usize minimum_match{ 4 };
+		constexpr usize maximum_literal{ 128 };
+
+		constexpr usize hash_bits{ 14 };
+
+		// no token costs more than two bytes per byte it produces: a lone literal takes a control byte and a match of at least four bytes takes a control byte and a distance of at most seven
+		constexpr usize compress_bound(usize count) noexcept { return count * 2; }
+
+		inline void compress(cptr<u8> source, usize count, ref<std::vector<u8>> stream) noexcept {
+			constexpr usize empty{ std::numeric_limits<usize>::max() };
+
+			std::vector<usize> table(usize{ 1 } << hash_bits, empty);
+
+			usize literal_start{ 0 };
+			usize i{ 0 };
+
+			const auto flush = [&](usize end) {
+				while (literal_start < end) {
+					const usize length{ min(maximum_literal, end - literal_start) };
+
+					stream.push_back(static_cast<u8>(length - 1));
+					stream.insert(stream.end(), source + literal_start, source + literal_start + length);
+
+					literal_start += length;
+				}
+			};
+
+			while (i + minimum_match <= count) {
+				u32 word;
+				std::memcpy(&word, source + i, sizeof(word));
+
+				const usize slot{ static_cast<usize>((word * 2654435761u) >> (32 - hash_bits)) };
+				const usize candidate{ table[slot] };
+
+				table[slot] = i;
+
+				if (candidate == empty || std::memcmp(source + candidate, source + i, minimum_match) != 0) {
+					++i;
+					continue;
+				}
+
+				// the match may overlap the bytes it produces, which is how runs of a repeated cell are expressed
+				const usize length{ minimum_match + simd::mismatch(source + candidate + minimum_match, source + i + minimum_match, count - i - minimum_match) };
+
+				flush(i);
+
+				const usize extra{ length - minimum_match };
+
+				if (extra < 0x7F) {
+					stream.push_back(static_cast<u8>(0x80 | extra));
+				} else {
+					stream.push_back(0xFF);
+					delta::write_varint(stream, extra - 0x7F);
+				}
+
+				delta::write_varint(stream, i - candidate);
+
+				i += length;
+				literal_start = i;
+			}
+
+			flush(count);
+		}
+
+		// decodes directly into the target, which must hold exactly the count of bytes the stream was compressed from
+		inline bool decompress(std::span<const u8> stream, ptr<u8> target, usize count) noexcept {
+			usize cursor{ 0 };
+			usize written{ 0 };
+
+			while (cursor < stream.size()) {
+				const u8 control{ stream[cursor++] };
+
+				if (control < 0x80) {
+					const usize length{ static_cast<usize>(control) + 1 };
+
+					if (length > stream.size() - cursor || length > count - written) {
+						return false;
+					}
+
+					std::memcpy(target + written, stream.data() + cursor, length);
+
+					cursor += length;
+					written += length;
+
+					continue;
+				}
+
+				usize length{ static_cast<usize>(control & 0x7F) };
+
+				if (length == 0x7F) {
+					usize extension{ 0 };
+
+					if (!delta::read_varint(stream, cursor, extension) || extension > count) {
+						return false;
+					}
+
+					length += extension;
+				}
+
+				length += minimum_match;
+
+				usize distance{ 0 };
+
+				if (!delta::read_varint(stream, cursor, distance) || distance == 0 || distance > written || length > count - written) {
+					return false;
+				}
+
+				ptr<u8> output{ target + written };
+
+				if (distance == 1) {
+					std::memset(output, output[-1], length);
+				} else {
+					// the first period comes from behind the output, after which the run doubles by copying what it has already written; no copy overlaps itself
+					usize copied{ min(distance, length) };
+
+					std::memcpy(output, output - distance, copied);
+
+					while (copied < length) {
+						const usize span{ min(copied, length - copied) };
+
+						std::memcpy(output + copied, output, span);
+
+						copied += span;
+					}
+				}
+
+				written += length;
+			}
+
+			return written == count;
+		}
+
+		// compresses chunk(i) for every chunk, each of which must address the chunk size in bytes, and writes the container
+		template<typename Chunk> inline bool write(cref<std::string> path, u64 type_hash, usize chunk_size, usize chunk_count, rval<Chunk> chunk) noexcept {
+			std::vector<entry_t> index(chunk_count);
+			std::vector<u8> payload{};
+
+			const usize payload_offset{ sizeof(header_t) + chunk_count * sizeof(entry_t) };
+
+			for (usize i{ 0 }; i < chunk_count; ++i) {
+				cptr<u8> source{ chunk(i) };
+
+				const usize offset{ payload.size() };
+
+				compress(source, chunk_size, payload);
+
+				index[i] = entry_t{ payload_offset + offset, payload.size() - offset, checksum(source, chunk_size) };
+			}
+
+			const header_t header{ magic, version, 0, chunk_count, chunk_size, type_hash, checksum(reinterpret_cast<cptr<u8>>(index.data()), index.size() * sizeof(entry_t)) };
+
+			std::ofstream file{};
+
+			file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+			if (!file.is_open()) {
+				error_log.add("[ERROR]: failed to open archive for writing!", __TIME_FILE_LINE__);
+				return false;
+			}
+
+			file.write(reinterpret_cast<cstr>(&header), sizeof(header));
+			file.write(reinterpret_cast<cstr>(index.data()), index.size() * sizeof(entry_t));
+			file.write(reinterpret_cast<cstr>(payload.data()), payload.size());
+
+			file.close();
+
+			return !file.fail();
+		}
+
+		// validates the header and index against the size of the file on open; each chunk is then read into a reused buffer and decompressed into a reused scratch chunk, which only reaches its destination once its checksum matches
+		struct reader_t {
+		  private:
+			std::ifstream file;
+
+			header_t header;
+			std::vector<entry_t> index;
+			std::vector<u8> buffer;
+			std::vector<u8> scratch;
+
+			bool valid;
+
+		  public:
+			inline reader_t(cref<std::string> path, u64 type_hash, usize chunk_size) noexcept : file{}, header{}, index{}, buffer{}, scratch{}, valid{ false } {
+				file.open(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+				if (!file.is_open()) {
+					error_log.add("[ERROR]: failed to open archive for reading!", __TIME_FILE_LINE__);
+					return;
+				}
+
+				const std::streamoff file_size{ file.tellg() };
+
+				file.seekg(0, std::ios::beg);
+
+				if (file_size < 0) {
+					error_log.add("[ERROR]: failed to determine the size of the archive!", __TIME_FILE_LINE__);
+					return;
+				}
+
+				if (!file.read(reinterpret_cast<str>(&header), sizeof(header)) || header.magic != magic || header.version != version) {
+					error_log.add("[ERROR]: file is not an archive or was written by an unsupported version!", __TIME_FILE_LINE__);
+					return;
+				}
+
+				if (header.type_hash != type_hash || header.chunk_size != chunk_size) {
+					error_log.add("[ERROR]: archive was written from a different type!", __TIME_FILE_LINE__);
+					return;
+				}
+
+				const usize length{ static_cast<usize>(file_size) };
+
+				// the header has been read, so the length is at least its size
+				if (header.chunk_count > (length - sizeof(header_t)) / sizeof(entry_t)) {
+					error_log.add("[ERROR]: archive index extends beyond the end of the file!", __TIME_FILE_LINE__);
+					return;
+				}
+
+				index.resize(header.chunk_count);
+
+				if (!file.read(reinterpret_cast<str>(index.data()), index.size() * sizeof(entry_t)) || checksum(reinterpret_cast<cptr<u8>>(index.data()), index.size() * sizeof(entry_t)) != header.index_checksum) {
+					error_log.add("[ERROR]: archive index is corrupt!", __TIME_FILE_LINE__);
+					return;
+				}
+
+				const usize payload_offset{ sizeof(header_t) + index.size() * sizeof(entry_t) };
+
+				for (cauto entry : index) {
+					if (entry.offset < payload_offset || entry.offset > length || entry.length > length - entry.offset || entry.length > compress_bound(chunk_size)) {
+						error_log.add("[ERROR]: archive index addresses a chunk outside of the file!", __TIME_FILE_LINE__);
+						return;
+					}
+				}
+
+				scratch.resize(chunk_size);
+
+				valid = true;
+			}
+
+			inline reader_t(cref<reader_t> other) noexcept = delete;
+
+			inline reader_t(rval<reader_t> other) noexcept = default;
+
+			inline ref<reader_t> operator=(cref<reader_t> other) noexcept = delete;
+
+			inline ref<reader_t> operator=(rval<reader_t> other) noexcept = default;
+
+			inline ~reader_t() noexcept {}
+
+			inline bool is_valid() const noexcept { return valid; }
+
+			inline usize chunk_count() const noexcept { return valid ? static_cast<usize>(header.chunk_count) : 0; }
+
+			// leaves the target untouched unless the whole chunk decodes and matches its checksum
+			inline bool read(usize chunk, ptr<u8> target) noexcept {
+				if (!valid || chunk >= index.size()) {
+					return false;
+				}
+
+				cref<entry_t> entry{ index[chunk] };
+
+				buffer.resize(entry.length);
+
+				file.clear();
+				file.seekg(static_cast<std::streamoff>(entry.offset), std::ios::beg);
+
+				if (!file.read(reinterpret_cast<str>(buffer.data()), static_cast<std::streamsize>(entry.length))) {
+					error_log.add("[ERROR]: archive chunk is truncated!", __TIME_FILE_LINE__);
+					return false;
+				}
+
+				if (!decompress(buffer, scratch.data(), scratch.size()) || checksum(scratch.data(), scratch.size()) != entry.checksum) {
+					error_log.add("[ERROR]: archive chunk is corrupt!", __TIME_FILE_LINE__);
+					return false;
+				}
+
+				std::memcpy(target, scratch.data(), scratch.size());
+
+				return true;
+			}
+		};
+	} // namespace archive
+} // namespace bleak
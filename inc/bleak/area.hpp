@@ -26,13 +26,13 @@ namespace bleak {
 
 		inline area_t() noexcept {}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> collect(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> collect(cref<Zone> zone, cref<typename Zone::value_type> value) {
 			if constexpr (!Defer) {
 				clear();
 			}
 
-			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
-				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+			for (extent_t::scalar_t y{ 0 }; y < Zone::zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Zone::zone_size.w; ++x) {
 					if (zone[x, y] != value) {
 						continue;
 					}
@@ -44,15 +44,15 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> collect(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> collect(cref<Zone> zone, cref<U> value) {
 			if constexpr (!Defer) {
 				clear();
 			}
 
-			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
-				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+			for (extent_t::scalar_t y{ 0 }; y < Zone::zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Zone::zone_size.w; ++x) {
 					if (zone[x, y] != value) {
 						continue;
 					}
@@ -64,7 +64,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> flood(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<T> value, bool inclusive = false) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> flood(cref<Zone> zone, offset_t position, cref<typename Zone::value_type> value, bool inclusive = false) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -102,7 +102,7 @@ namespace bleak {
 						}
 
 						frontier.push(neighbour);
-						insert(current);
+						insert(neighbour);
 					}
 				}
 			}
@@ -110,9 +110,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> flood(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<U> value, bool inclusive = false) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> flood(cref<Zone> zone, offset_t position, cref<U> value, bool inclusive = false) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -158,8 +158,8 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false>
-		inline ref<area_t> flood(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<T> value, cref<extent_t::product_t> distance, bool inclusive = false) {
+		template<ZoneLike Zone, bool Defer = false>
+		inline ref<area_t> flood(cref<Zone> zone, offset_t position, cref<typename Zone::value_type> value, cref<extent_t::product_t> distance, bool inclusive = false) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -205,9 +205,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> flood(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<U> value, cref<extent_t::product_t> distance, bool inclusive = false) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> flood(cref<Zone> zone, offset_t position, cref<U> value, cref<extent_t::product_t> distance, bool inclusive = false) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -253,7 +253,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value, offset_t position, u32 radius, bool inclusive = false) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> cast(cref<Zone> zone, cref<typename Zone::value_type> value, offset_t position, u32 radius, bool inclusive = false) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -293,9 +293,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, offset_t position, u32 radius, bool inclusive) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> cast(cref<Zone> zone, cref<U> value, offset_t position, u32 radius, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -335,7 +335,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value, cref<circle_t> circle, bool inclusive = false) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> cast(cref<Zone> zone, cref<typename Zone::value_type> value, cref<circle_t> circle, bool inclusive = false) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -375,9 +375,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<circle_t> circle, bool inclusive) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> cast(cref<Zone> zone, cref<U> value, cref<circle_t> circle, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -417,7 +417,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value, offset_t position, u32 radius, f64 angle, f64 span, bool inclusive) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> cast(cref<Zone> zone, cref<typename Zone::value_type> value, offset_t position, u32 radius, f64 angle, f64 span, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -465,9 +465,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, offset_t position, u32 radius, f64 angle, f64 span, bool inclusive) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> cast(cref<Zone> zone, cref<U> value, offset_t position, u32 radius, f64 angle, f64 span, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -515,7 +515,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value, cref<arc_t> arc, bool inclusive) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> cast(cref<Zone> zone, cref<typename Zone::value_type> value, cref<arc_t> arc, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -566,9 +566,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<arc_t> arc, bool inclusive) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> cast(cref<Zone> zone, cref<U> value, cref<arc_t> arc, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
@@ -619,53 +619,53 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> multi_cast(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value, cref<std::vector<circle_t>> circles, bool inclusive) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> multi_cast(cref<Zone> zone, cref<typename Zone::value_type> value, cref<std::vector<circle_t>> circles, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
 
 			for (crauto circle : circles) {
-				cast<T, Size, BorderSize, true>(zone, value, circle, inclusive);
+				cast<Zone, true>(zone, value, circle, inclusive);
 			}
 
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> multi_cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<std::vector<circle_t>> circles, bool inclusive) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> multi_cast(cref<Zone> zone, cref<U> value, cref<std::vector<circle_t>> circles, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
 
 			for (crauto circle : circles) {
-				cast<T, U, Size, BorderSize, true>(zone, value, circle, inclusive);
+				cast<Zone, U, true>(zone, value, circle, inclusive);
 			}
 
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, bool Defer = false> inline ref<area_t> multi_cast(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value, cref<std::vector<arc_t>> arcs, bool inclusive) {
+		template<ZoneLike Zone, bool Defer = false> inline ref<area_t> multi_cast(cref<Zone> zone, cref<typename Zone::value_type> value, cref<std::vector<arc_t>> arcs, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
 
 			for (crauto arc : arcs) {
-				cast<T, Size, BorderSize, true>(zone, value, arc, inclusive);
+				cast<Zone, true>(zone, value, arc, inclusive);
 			}
 
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize, bool Defer = false>
-			requires is_equatable<T, U>::value
-		inline ref<area_t> multi_cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<std::vector<arc_t>> arcs, bool inclusive) {
+		template<ZoneLike Zone, typename U, bool Defer = false>
+			requires is_zone_comparable<Zone, U>::value
+		inline ref<area_t> multi_cast(cref<Zone> zone, cref<U> value, cref<std::vector<arc_t>> arcs, bool inclusive) {
 			if constexpr (!Defer) {
 				clear();
 			}
 
 			for (crauto arc : arcs) {
-				cast<T, U, Size, BorderSize, true>(zone, value, arc, inclusive);
+				cast<Zone, U, true>(zone, value, arc, inclusive);
 			}
 
 			return *this;
@@ -673,7 +673,7 @@ namespace bleak {
 
 		inline bool contains(offset_t position) const noexcept { return find(position) != end(); }
 
-		template<typename T, extent_t Size, extent_t BorderSize> inline cref<area_t> set(ref<zone_t<T, Size, BorderSize>> zone, cref<T> value) const noexcept {
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout> inline cref<area_t> set(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<T> value) const noexcept {
 			for (offset_t position : *this) {
 				zone[position] = value;
 			}
@@ -681,9 +681,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize>
+		template<typename T, typename U, extent_t Size, extent_t BorderSize, typename Layout>
 			requires std::is_assignable<T, U>::value
-		inline cref<area_t> set(ref<zone_t<T, Size, BorderSize>> zone, cref<U> value) const noexcept {
+		inline cref<area_t> set(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<U> value) const noexcept {
 			for (offset_t position : *this) {
 				zone[position] = value;
 			}
@@ -691,9 +691,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize>
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout>
 			requires is_operable_unary<T, operator_e::Addition>::value
-		inline cref<area_t> apply(ref<zone_t<T, Size, BorderSize>> zone, cref<T> value) const noexcept {
+		inline cref<area_t> apply(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<T> value) const noexcept {
 			for (offset_t position : *this) {
 				zone[position] += value;
 			}
@@ -701,9 +701,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize>
+		template<typename T, typename U, extent_t Size, extent_t BorderSize, typename Layout>
 			requires is_operable<T, U, operator_e::Addition>::value
-		inline cref<area_t> apply(ref<zone_t<T, Size, BorderSize>> zone, cref<U> value) const noexcept {
+		inline cref<area_t> apply(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<U> value) const noexcept {
 			for (offset_t position : *this) {
 				zone[position] += value;
 			}
@@ -711,9 +711,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, typename... Params>
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout, typename... Params>
 			requires(is_operable<T, Params, operator_e::Addition>::value, ...) && is_plurary<Params...>::value
-		inline cref<area_t> apply(ref<zone_t<T, Size, BorderSize>> zone, cref<Params>... values) const noexcept {
+		inline cref<area_t> apply(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<Params>... values) const noexcept {
 			for (offset_t position : *this) {
 				for (crauto value : { values... }) {
 					zone[position] += value;
@@ -723,9 +723,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize>
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout>
 			requires is_operable_unary<T, operator_e::Subtraction>::value
-		inline cref<area_t> repeal(ref<zone_t<T, Size, BorderSize>> zone, cref<T> value) const noexcept {
+		inline cref<area_t> repeal(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<T> value) const noexcept {
 			for (offset_t position : *this) {
 				zone[position] -= value;
 			}
@@ -733,9 +733,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize>
+		template<typename T, typename U, extent_t Size, extent_t BorderSize, typename Layout>
 			requires is_operable<T, U, operator_e::Subtraction>::value
-		inline cref<area_t> repeal(ref<zone_t<T, Size, BorderSize>> zone, cref<U> value) const noexcept {
+		inline cref<area_t> repeal(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<U> value) const noexcept {
 			for (offset_t position : *this) {
 				zone[position] -= value;
 			}
@@ -743,9 +743,9 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, typename... Params>
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout, typename... Params>
 			requires(is_operable<T, Params, operator_e::Subtraction>::value, ...) && is_plurary<Params...>::value
-		inline cref<area_t> repeal(ref<zone_t<T, Size, BorderSize>> zone, cref<Params>... values) const noexcept {
+		inline cref<area_t> repeal(ref<zone_t<T, Size, BorderSize, Layout>> zone, cref<Params>... values) const noexcept {
 			for (offset_t position : *this) {
 				for (crauto value : { values... }) {
 					zone[position] -= value;
@@ -755,7 +755,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, RandomEngine Generator> inline cref<area_t> randomize(ref<zone_t<T, Size, BorderSize>> zone, ref<Generator> generator, f64 probability, cref<binary_applicator_t<T>> applicator) const noexcept {
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout, RandomEngine Generator> inline cref<area_t> randomize(ref<zone_t<T, Size, BorderSize, Layout>> zone, ref<Generator> generator, f64 probability, cref<binary_applicator_t<T>> applicator) const noexcept {
 			std::bernoulli_distribution dis{ probability };
 
 			for (offset_t position : *this) {
@@ -765,7 +765,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize, RandomEngine Generator> inline cref<area_t> randomize(ref<zone_t<T, Size, BorderSize>> zone, ref<Generator> generator, f64 probability, cref<T> true_value, cref<T> false_value) const noexcept {
+		template<typename T, extent_t Size, extent_t BorderSize, typename Layout, RandomEngine Generator> inline cref<area_t> randomize(ref<zone_t<T, Size, BorderSize, Layout>> zone, ref<Generator> generator, f64 probability, cref<T> true_value, cref<T> false_value) const noexcept {
 			std::bernoulli_distribution dis{ probability };
 
 			for (offset_t position : *this) {
@@ -791,7 +791,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize> static std::vector<area_t> partition(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value) {
+		template<ZoneLike Zone> static std::vector<area_t> partition(cref<Zone> zone, cref<typename Zone::value_type> value) {
 			std::vector<area_t> partitions{};
 
 			area_t values{};
@@ -809,9 +809,9 @@ namespace bleak {
 			return partitions;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize>
-			requires is_equatable<T, U>::value
-		static std::vector<area_t> partition(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) {
+		template<ZoneLike Zone, typename U>
+			requires is_zone_comparable<Zone, U>::value
+		static std::vector<area_t> partition(cref<Zone> zone, cref<U> value) {
 			std::vector<area_t> partitions{};
 
 			area_t values{};
@@ -830,7 +830,7 @@ namespace bleak {
 		}
 
 	  private:
-		template<typename T, extent_t Size, extent_t BorderSize> inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<T> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius) {
+		template<ZoneLike Zone> inline void shadow_cast(cref<Zone> zone, offset_t origin, cref<typename Zone::value_type> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius) {
 			if (start < end) {
 				return;
 			}
@@ -882,9 +882,9 @@ namespace bleak {
 			}
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize>
-			requires is_equatable<T, U>::value
-		inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<U> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius) {
+		template<ZoneLike Zone, typename U>
+			requires is_zone_comparable<Zone, U>::value
+		inline void shadow_cast(cref<Zone> zone, offset_t origin, cref<U> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius) {
 			if (start < end) {
 				return;
 			}
@@ -938,8 +938,8 @@ namespace bleak {
 			return;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize>
-		inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<T> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius, f64 angle, f64 span) {
+		template<ZoneLike Zone>
+		inline void shadow_cast(cref<Zone> zone, offset_t origin, cref<typename Zone::value_type> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius, f64 angle, f64 span) {
 			if (start < end) {
 				return;
 			}
@@ -993,9 +993,9 @@ namespace bleak {
 			return;
 		}
 
-		template<typename T, typename U, extent_t Size, extent_t BorderSize>
-			requires is_equatable<T, U>::value
-		inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<U> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius, f64 angle, f64 span) {
+		template<ZoneLike Zone, typename U>
+			requires is_zone_comparable<Zone, U>::value
+		inline void shadow_cast(cref<Zone> zone, offset_t origin, cref<U> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius, f64 angle, f64 span) {
 			if (start < end) {
 				return;
 			}
@@ -3,31 +3,41 @@
 #include <bleak/typedef.hpp>
 
 #include <array>
+#include <compare>
 #include <initializer_list>
+#include <iterator>
 #include <type_traits>
 
 #include <bleak/concepts.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/hash.hpp>
 #include <bleak/iter.hpp>
+#include <bleak/layout.hpp>
 #include <bleak/log.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/utility.hpp>
 
 namespace bleak {
-	template<typename T, extent_t Size> struct array_t {
+	template<typename T, extent_t Size, typename Layout = row_major_layout_t> struct array_t {
+	  public:
+		using layout_t = Layout;
+
+		static constexpr usize capacity{ Layout::template capacity<Size> };
+
 	  private:
-		std::array<T, Size.area()> data;
+		typename Layout::template container_t<T, capacity> data;
 
 	  public:
 		static constexpr extent_t size{ Size };
 
 		static constexpr usize area{ Size.size() };
 
-		static constexpr usize byte_size{ area * sizeof(T) };
+		static constexpr usize byte_size{ capacity * sizeof(T) };
+
+		static constexpr bool contiguous_rows{ Layout::contiguous_rows };
 
 		static_assert(area > 0, "array size must have a size greater than zero!");
-		static_assert(area * sizeof(T) <= memory::Maximum, "array size must not exceed the maximum!");
+		static_assert(byte_size <= memory::Maximum, "array size must not exceed the maximum!");
 
 		static constexpr usize first{ 0 };
 		static constexpr usize last{ area - 1 };
@@ -35,55 +45,164 @@ namespace bleak {
 		static constexpr extent_t::scalar_t width{ size.w };
 		static constexpr extent_t::scalar_t height{ size.h };
 
-		static inline constexpr usize flatten(offset_t offset) noexcept { return static_cast<usize>(offset.y) * Size.w + offset.x; }
+		static inline constexpr usize flatten(offset_t offset) noexcept { return Layout::template flatten<Size>(offset.x, offset.y); }
 
-		static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return static_cast<usize>(j) * Size.w + i; }
+		static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return Layout::template flatten<Size>(i, j); }
+
+		// maps a row-major cell index onto its storage index
+		static inline constexpr usize linearize(usize index) noexcept {
+			if constexpr (contiguous_rows) {
+				return index;
+			} else {
+				return flatten(static_cast<offset_t::scalar_t>(index % Size.w), static_cast<offset_t::scalar_t>(index / Size.w));
+			}
+		}
 
 		static inline constexpr offset_t unflatten(usize index) noexcept { return offset_t{ index / Size.w, index % Size.w }; }
 
-		using iterator = fwd_iter_t<T>;
-		using const_iterator = fwd_iter_t<const T>;
+		// walks the cells in logical row-major order through the layout, so that padded layouts neither skip nor expose cells outside the array
+		template<typename Value> struct cell_iter_t {
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::remove_const_t<Value>;
+			using pointer = ptr<Value>;
+			using reference = ref<Value>;
+
+			pointer base;
+			usize index;
+
+			constexpr reference operator*() const noexcept { return base[linearize(index)]; }
+
+			constexpr pointer operator->() const noexcept { return &base[linearize(index)]; }
+
+			constexpr reference operator[](difference_type offset) const noexcept { return base[linearize(static_cast<usize>(static_cast<difference_type>(index) + offset))]; }
+
+			constexpr ref<cell_iter_t> operator++() noexcept {
+				++index;
+				return *this;
+			}
+
+			constexpr cell_iter_t operator++(int) noexcept { return cell_iter_t{ base, index++ }; }
 
-		using reverse_iterator = rev_iter_t<T>;
-		using const_reverse_iterator = rev_iter_t<const T>;
+			constexpr ref<cell_iter_t> operator--() noexcept {
+				--index;
+				return *this;
+			}
 
-		inline constexpr iterator begin() noexcept { return data.begin(); }
+			constexpr cell_iter_t operator--(int) noexcept { return cell_iter_t{ base, index-- }; }
 
-		inline constexpr iterator end() noexcept { return data.end(); }
+			constexpr ref<cell_iter_t> operator+=(difference_type offset) noexcept {
+				index = static_cast<usize>(static_cast<difference_type>(index) + offset);
+				return *this;
+			}
 
-		inline constexpr const_iterator begin() const noexcept { return data.begin(); }
+			constexpr ref<cell_iter_t> operator-=(difference_type offset) noexcept { return *this += -offset; }
 
-		inline constexpr const_iterator end() const noexcept { return data.end(); }
+			constexpr cell_iter_t operator+(difference_type offset) const noexcept { return cell_iter_t{ *this } += offset; }
 
-		inline constexpr const_iterator cbegin() const noexcept { return data.cbegin(); }
+			constexpr cell_iter_t operator-(difference_type offset) const noexcept { return cell_iter_t{ *this } -= offset; }
 
-		inline constexpr const_iterator cend() const noexcept { return data.cend(); }
+			constexpr difference_type operator-(cref<cell_iter_t> other) const noexcept { return static_cast<difference_type>(index) - static_cast<difference_type>(other.index); }
 
-		inline constexpr reverse_iterator rbegin() noexcept { return data.rbegin(); }
+			constexpr bool operator==(cref<cell_iter_t> other) const noexcept { return index == other.index; }
 
-		inline constexpr reverse_iterator rend() noexcept { return data.rend(); }
+			constexpr auto operator<=>(cref<cell_iter_t> other) const noexcept { return index <=> other.index; }
 
-		inline constexpr const_reverse_iterator rbegin() const noexcept { return data.rbegin(); }
+			constexpr operator cell_iter_t<const Value>() const noexcept { return cell_iter_t<const Value>{ base, index }; }
+		};
 
-		inline constexpr const_reverse_iterator rend() const noexcept { return data.rend(); }
+		// row-major storage is iterated directly; every other layout is iterated cell by cell in row-major order
+		using iterator = std::conditional<contiguous_rows, fwd_iter_t<T>, cell_iter_t<T>>::type;
+		using const_iterator = std::conditional<contiguous_rows, fwd_iter_t<const T>, cell_iter_t<const T>>::type;
 
-		inline constexpr const_reverse_iterator crbegin() const noexcept { return data.crbegin(); }
+		using reverse_iterator = std::conditional<contiguous_rows, rev_iter_t<T>, std::reverse_iterator<cell_iter_t<T>>>::type;
+		using const_reverse_iterator = std::conditional<contiguous_rows, rev_iter_t<const T>, std::reverse_iterator<cell_iter_t<const T>>>::type;
 
-		inline constexpr const_reverse_iterator crend() const noexcept { return data.crend(); }
+		inline constexpr iterator begin() noexcept {
+			if constexpr (contiguous_rows) {
+				return data.begin();
+			} else {
+				return iterator{ data.data(), 0 };
+			}
+		}
 
-		inline constexpr ref<T> front() noexcept { return data[first]; }
+		inline constexpr iterator end() noexcept {
+			if constexpr (contiguous_rows) {
+				return data.end();
+			} else {
+				return iterator{ data.data(), area };
+			}
+		}
 
-		inline constexpr cref<T> front() const noexcept { return data[first]; }
+		inline constexpr const_iterator begin() const noexcept {
+			if constexpr (contiguous_rows) {
+				return data.begin();
+			} else {
+				return const_iterator{ data.data(), 0 };
+			}
+		}
 
-		inline constexpr ref<T> back() noexcept { return data[last]; }
+		inline constexpr const_iterator end() const noexcept {
+			if constexpr (contiguous_rows) {
+				return data.end();
+			} else {
+				return const_iterator{ data.data(), area };
+			}
+		}
+
+		inline constexpr const_iterator cbegin() const noexcept { return begin(); }
 
-		inline constexpr cref<T> back() const noexcept { return data[last]; }
+		inline constexpr const_iterator cend() const noexcept { return end(); }
+
+		inline constexpr reverse_iterator rbegin() noexcept {
+			if constexpr (contiguous_rows) {
+				return data.rbegin();
+			} else {
+				return reverse_iterator{ end() };
+			}
+		}
+
+		inline constexpr reverse_iterator rend() noexcept {
+			if constexpr (contiguous_rows) {
+				return data.rend();
+			} else {
+				return reverse_iterator{ begin() };
+			}
+		}
+
+		inline constexpr const_reverse_iterator rbegin() const noexcept {
+			if constexpr (contiguous_rows) {
+				return data.rbegin();
+			} else {
+				return const_reverse_iterator{ end() };
+			}
+		}
+
+		inline constexpr const_reverse_iterator rend() const noexcept {
+			if constexpr (contiguous_rows) {
+				return data.rend();
+			} else {
+				return const_reverse_iterator{ begin() };
+			}
+		}
+
+		inline constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+		inline constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+		inline constexpr ref<T> front() noexcept { return data[linearize(first)]; }
+
+		inline constexpr cref<T> front() const noexcept { return data[linearize(first)]; }
+
+		inline constexpr ref<T> back() noexcept { return data[linearize(last)]; }
+
+		inline constexpr cref<T> back() const noexcept { return data[linearize(last)]; }
 
 		inline constexpr array_t() : data{} {}
 
 		inline constexpr array_t(std::array<T, area> elements) : data{} {
 			for (usize i{ 0 }; i < area; ++i) {
-				data[i] = elements[i];
+				data[linearize(i)] = elements[i];
 			}
 		}
 
@@ -91,7 +210,7 @@ namespace bleak {
 			requires std::is_convertible<U, T>::value
 		inline constexpr explicit array_t(std::array<U, area> elements) : data{} {
 			for (usize i{ 0 }; i < area; ++i) {
-				data[i] = elements[i];
+				data[linearize(i)] = elements[i];
 			}
 		}
 
@@ -102,7 +221,7 @@ namespace bleak {
 
 			usize i{ 0 };
 			for (auto element : elements) {
-				data[i++] = element;
+				data[linearize(i++)] = element;
 			}
 		}
 
@@ -110,18 +229,18 @@ namespace bleak {
 			requires is_homogeneous<T, Params...>::value && is_plurary<Params...>::value && (sizeof...(Params) <= Size.size())
 		inline constexpr array_t(cref<Params>... elements) : data{} {
 			usize i{ 0 };
-			((data[i++] = elements), ...);
+			((data[linearize(i++)] = elements), ...);
 		}
 
 		template<typename... Params>
 			requires is_homogeneous<T, Params...>::value && is_plurary<Params...>::value && (sizeof...(Params) <= Size.size())
 		inline constexpr array_t(rval<Params>... elements) : data{} {
 			usize i{ 0 };
-			((data[i++] = std::move(elements)), ...);
+			((data[linearize(i++)] = std::move(elements)), ...);
 		}
 
 		inline constexpr array_t(cref<array_t> other) : data{} {
-			for (usize i{ 0 }; i < area; ++i) {
+			for (usize i{ 0 }; i < capacity; ++i) {
 				data[i] = other.data[i];
 			}
 		}
@@ -133,7 +252,7 @@ namespace bleak {
 				return *this;
 			}
 
-			for (usize i{ 0 }; i < area; ++i) {
+			for (usize i{ 0 }; i < capacity; ++i) {
 				data[i] = other.data[i];
 			}
 
@@ -152,23 +271,27 @@ namespace bleak {
 
 		inline constexpr ~array_t() noexcept {}
 
+		// an explicit deep copy; preferred over the copy constructor where a copy of heap-backed storage is intended
+		inline constexpr array_t clone() const noexcept { return array_t{ *this }; }
+
 		inline constexpr ref<T> operator[](offset_t offset) noexcept { return data[first + flatten(offset)]; }
 
 		inline constexpr cref<T> operator[](offset_t offset) const noexcept { return data[first + flatten(offset)]; }
 
-		inline constexpr ref<T> operator[](offset_t::product_t index) noexcept { return data[first + index]; }
+		inline constexpr ref<T> operator[](offset_t::product_t index) noexcept { return data[linearize(first + index)]; }
 
-		inline constexpr cref<T> operator[](offset_t::product_t index) const noexcept { return data[first + index]; }
+		inline constexpr cref<T> operator[](offset_t::product_t index) const noexcept { return data[linearize(first + index)]; }
 
 		inline constexpr ref<T> operator[](offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return data[first + flatten(i, j)]; }
 
 		inline constexpr cref<T> operator[](offset_t::scalar_t i, offset_t::scalar_t j) const noexcept { return data[first + flatten(i, j)]; }
 
-		inline constexpr bool is_valid(offset_t offset) const noexcept { return between<offset_t::product_t>(flatten(offset), 0, area); }
+		inline constexpr bool is_valid(offset_t offset) const noexcept { return is_valid(offset.x, offset.y); }
 
-		inline constexpr bool is_valid(offset_t::product_t index) const noexcept { return between<offset_t::product_t>(index, 0, area); }
+		inline constexpr bool is_valid(offset_t::product_t index) const noexcept { return index >= 0 && index < static_cast<offset_t::product_t>(area); }
 
-		inline constexpr bool is_valid(offset_t::scalar_t i, offset_t::scalar_t j) const noexcept { return between<offset_t::product_t>(flatten(i, j), 0, area); }
+		// each axis is bounded on its own, as a flattened index would let a position past the end of one row pass for the start of the next
+		inline constexpr bool is_valid(offset_t::scalar_t i, offset_t::scalar_t j) const noexcept { return i >= 0 && i < Size.w && j >= 0 && j < Size.h; }
 
 		inline constexpr ref<T> at(offset_t offset) {
 			if (!is_valid(offset)) {
@@ -191,7 +314,7 @@ namespace bleak {
 				error_log.add("ERROR: offset out of range!");
 			}
 
-			return data[first + index];
+			return data[linearize(first + index)];
 		}
 
 		inline constexpr cref<T> at(offset_t::product_t index) const {
@@ -199,7 +322,7 @@ namespace bleak {
 				error_log.add("ERROR: offset out of range!");
 			}
 
-			return data[first + index];
+			return data[linearize(first + index)];
 		}
 
 		inline constexpr ref<T> at(offset_t::scalar_t i, offset_t::scalar_t j) {
@@ -218,13 +341,14 @@ namespace bleak {
 			return data[first + flatten(i, j)];
 		}
 
-		constexpr ptr<T> data_ptr() noexcept { return data; }
+		constexpr ptr<T> data_ptr() noexcept { return data.data(); }
 
-		constexpr cptr<T> data_ptr() const noexcept { return data; }
+		constexpr cptr<T> data_ptr() const noexcept { return data.data(); }
 
+		// only the cells of the array take part; the padding of tiled and morton storage does not
 		constexpr bool operator==(cref<array_t> other) const noexcept {
-			for (usize i{0}; i < area; ++i) {
-				if (data[i] != other.data[i]) {
+			for (usize i{ 0 }; i < area; ++i) {
+				if (data[linearize(i)] != other.data[linearize(i)]) {
 					return false;
 				}
 			}
@@ -232,18 +356,18 @@ namespace bleak {
 			return true;
 		}
 
-		constexpr bool operator!=(cref<array_t> other) const noexcept {
-			for (usize i{0}; i < area; ++i) {
-				if (data[i] != other.data[i]) {
-					return true;
-				}
-			}
-
-			return false;
-		}
+		constexpr bool operator!=(cref<array_t> other) const noexcept { return !(*this == other); }
 
 		struct hasher {
-			static constexpr usize operator()(cref<array_t<T, Size>> array) { return hash_array(array.begin(), array.end()); }
+			static constexpr usize operator()(cref<array_t<T, Size, Layout>> array) {
+				usize seed{ 0 };
+
+				for (usize i{ 0 }; i < area; ++i) {
+					hash_combine(seed, array.data[linearize(i)]);
+				}
+
+				return seed;
+			}
 		};
 	};
 } // namespace bleak
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+
+#include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// the words are held in the container of the storage policy, so planes packed from heap-backed zones are themselves heap-backed
+	template<extent_t Size, typename Storage = row_major_layout_t> struct bitplane_t {
+	  public:
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize stride{ (static_cast<usize>(Size.w) + 63) / 64 };
+
+		static constexpr usize word_count{ stride * static_cast<usize>(Size.h) };
+
+		static constexpr usize byte_size{ word_count * sizeof(u64) };
+
+		static_assert(word_count > 0, "bitplane size must have a size greater than zero!");
+		static_assert(byte_size <= memory::Maximum, "bitplane size must not exceed the maximum!");
+
+		// valid bits of the final word in each row
+		static constexpr u64 tail_mask{ Size.w % 64 == 0 ? ~u64{ 0 } : (u64{ 1 } << (Size.w % 64)) - 1 };
+
+	  private:
+		typename Storage::template container_t<u64, word_count> words;
+
+		static constexpr usize word_index(offset_t position) noexcept { return static_cast<usize>(position.y) * stride + static_cast<usize>(position.x) / 64; }
+
+		static constexpr u64 bit_mask(offset_t position) noexcept { return u64{ 1 } << (static_cast<usize>(position.x) % 64); }
+
+		// cells beyond the edges of the plane are read as set
+		constexpr u64 fetch(isize y, isize i) const noexcept {
+			if (y < 0 || y >= Size.h || i < 0 || i >= static_cast<isize>(stride)) {
+				return ~u64{ 0 };
+			}
+
+			const u64 word{ words[static_cast<usize>(y) * stride + static_cast<usize>(i)] };
+
+			return i == static_cast<isize>(stride) - 1 ? word | ~tail_mask : word;
+		}
+
+		constexpr u64 fetch_west(isize y, isize i) const noexcept { return (fetch(y, i) << 1) | (fetch(y, i - 1) >> 63); }
+
+		constexpr u64 fetch_east(isize y, isize i) const noexcept { return (fetch(y, i) >> 1) | (fetch(y, i + 1) << 63); }
+
+	  public:
+		constexpr bitplane_t() noexcept : words{} {}
+
+		constexpr bitplane_t(cref<bitplane_t> other) noexcept : words{ other.words } {}
+
+		constexpr bitplane_t(rval<bitplane_t> other) noexcept : words{ std::move(other.words) } {}
+
+		constexpr ref<bitplane_t> operator=(cref<bitplane_t> other) noexcept {
+			if (this != &other) {
+				words = other.words;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<bitplane_t> operator=(rval<bitplane_t> other) noexcept {
+			if (this != &other) {
+				words = std::move(other.words);
+			}
+
+			return *this;
+		}
+
+		constexpr ~bitplane_t() noexcept {}
+
+		constexpr bool test(offset_t position) const noexcept { return words[word_index(position)] & bit_mask(position); }
+
+		constexpr bool operator[](offset_t position) const noexcept { return test(position); }
+
+		constexpr void set(offset_t position) noexcept { words[word_index(position)] |= bit_mask(position); }
+
+		constexpr void set(offset_t position, bool value) noexcept {
+			if (value) {
+				words[word_index(position)] |= bit_mask(position);
+			} else {
+				words[word_index(position)] &= ~bit_mask(position);
+			}
+		}
+
+		constexpr void reset(offset_t position) noexcept { words[word_index(position)] &= ~bit_mask(position); }
+
+		constexpr void clear() noexcept { words.fill(u64{ 0 }); }
+
+		constexpr cptr<u64> data_ptr() const noexcept { return words.data(); }
+
+		constexpr ptr<u64> data_ptr() noexcept { return words.data(); }
+
+		constexpr ref<bitplane_t> operator&=(cref<bitplane_t> other) noexcept {
+			for (usize i{ 0 }; i < word_count; ++i) {
+				words[i] &= other.words[i];
+			}
+
+			return *this;
+		}
+
+		constexpr ref<bitplane_t> operator|=(cref<bitplane_t> other) noexcept {
+			for (usize i{ 0 }; i < word_count; ++i) {
+				words[i] |= other.words[i];
+			}
+
+			return *this;
+		}
+
+		// clears every bit that is set in the other plane
+		constexpr ref<bitplane_t> exclude(cref<bitplane_t> other) noexcept {
+			for (usize i{ 0 }; i < word_count; ++i) {
+				words[i] &= ~other.words[i];
+			}
+
+			return *this;
+		}
+
+		// one generation of a moore-neighbourhood automaton over the cells selected by mask; out-of-bounds neighbours count as set.
+		// cells whose neighbour count equals the threshold keep the value already held in the target plane.
+		// only rows within [first_row, last_row) of the target are written, so disjoint row bands may be processed concurrently.
+		static constexpr void automatize(cref<bitplane_t> source, ref<bitplane_t> target, cref<bitplane_t> mask, u8 threshold, isize first_row, isize last_row) noexcept {
+			for (isize y{ max<isize>(first_row, 0) }; y < min<isize>(last_row, Size.h); ++y) {
+				for (isize i{ 0 }; i < static_cast<isize>(stride); ++i) {
+					const usize index{ static_cast<usize>(y) * stride + static_cast<usize>(i) };
+
+					const u64 selected{ mask.words[index] };
+
+					if (selected == 0) {
+						continue;
+					}
+
+					const u64 nw{ source.fetch_west(y - 1, i) };
+					const u64 n{ source.fetch(y - 1, i) };
+					const u64 ne{ source.fetch_east(y - 1, i) };
+
+					const u64 w{ source.fetch_west(y, i) };
+					const u64 e{ source.fetch_east(y, i) };
+
+					const u64 sw{ source.fetch_west(y + 1, i) };
+					const u64 s{ source.fetch(y + 1, i) };
+					const u64 se{ source.fetch_east(y + 1, i) };
+
+					// bit-sliced adder tree summing the eight neighbour planes into a four bit count
+					const u64 north_xor{ nw ^ n };
+					const u64 north_sum{ north_xor ^ ne };
+					const u64 north_carry{ (nw & n) | (ne & north_xor) };
+
+					const u64 middle_xor{ w ^ e };
+					const u64 middle_sum{ middle_xor ^ sw };
+					const u64 middle_carry{ (w & e) | (sw & middle_xor) };
+
+					const u64 south_sum{ s ^ se };
+					const u64 south_carry{ s & se };
+
+					const u64 ones_xor{ north_sum ^ middle_sum };
+					const u64 ones_carry{ (north_sum & middle_sum) | (south_sum & ones_xor) };
+
+					const u64 twos_xor{ north_carry ^ middle_carry };
+					const u64 twos_sum{ twos_xor ^ south_carry };
+					const u64 twos_carry{ (north_carry & middle_carry) | (south_carry & twos_xor) };
+
+					const u64 fours_carry{ twos_sum & ones_carry };
+
+					const std::array<u64, 4> count{
+						ones_xor ^ south_sum,
+						twos_sum ^ ones_carry,
+						twos_carry ^ fours_carry,
+						twos_carry & fours_carry
+					};
+
+					u64 greater{ 0 };
+					u64 lesser{ 0 };
+
+					if (threshold > 15) {
+						lesser = ~u64{ 0 };
+					} else {
+						u64 equal{ ~u64{ 0 } };
+
+						for (isize bit{ 3 }; bit >= 0; --bit) {
+							if ((threshold >> bit) & 1) {
+								lesser |= equal & ~count[bit];
+								equal &= count[bit];
+							} else {
+								greater |= equal & count[bit];
+								equal &= ~count[bit];
+							}
+						}
+					}
+
+					const u64 previous{ target.words[index] };
+					const u64 result{ greater | (~lesser & previous) };
+
+					target.words[index] = (previous & ~selected) | (result & selected);
+				}
+			}
+		}
+
+		static constexpr void automatize(cref<bitplane_t> source, ref<bitplane_t> target, cref<bitplane_t> mask, u8 threshold) noexcept { automatize(source, target, mask, threshold, 0, Size.h); }
+	};
+} // namespace bleak
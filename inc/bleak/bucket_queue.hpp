@@ -0,0 +1,97 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/creeper.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/utility.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// dial's algorithm: the seeds are sorted and every entry is then popped from a ring of buckets one wider than the longest step, in order of distance, rather than from a heap; only integral distances may be drained
+	template<Numeric D, distance_function_e DistanceFunction, typename Entry> struct bucket_queue_t {
+		// the longest step of the neighbourhood plus one, which is as many distances as can be in flight at once
+		static constexpr usize bucket_count{ []() -> usize {
+			usize longest{ 0 };
+
+			for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+				longest = max(longest, static_cast<usize>(creeper.distance));
+			}
+
+			return longest + 1;
+		}() };
+
+	  private:
+		std::array<std::vector<Entry>, bucket_count> buckets;
+
+	  public:
+		constexpr bucket_queue_t() noexcept : buckets{} {}
+
+		// each seed is pushed at its distance as enter(seed); visitor(entry, distance, push) may only push(entry, distance) at or beyond the distance being popped
+		template<typename Seed, typename Enter, typename Visitor> constexpr void drain(ref<std::vector<Seed>> seeds, cref<Enter> enter, rval<Visitor> visitor) noexcept {
+			if (seeds.empty()) {
+				return;
+			}
+
+			std::stable_sort(seeds.begin(), seeds.end(), [](cref<Seed> lhs, cref<Seed> rhs) -> bool { return lhs.distance < rhs.distance; });
+
+			const D base{ seeds.front().distance };
+
+			const auto bucket{ [&](D distance) -> ref<std::vector<Entry>> { return buckets[static_cast<usize>(distance - base) % bucket_count]; } };
+
+			D level{ base };
+
+			usize next_seed{ 0 };
+			usize pending{ 0 };
+
+			const auto push{ [&](cref<Entry> entry, D distance) {
+				bucket(distance).push_back(entry);
+				++pending;
+			} };
+
+			for (;;) {
+				for (; next_seed < seeds.size() && seeds[next_seed].distance == level; ++next_seed) {
+					push(enter(seeds[next_seed]), level);
+				}
+
+				ref<std::vector<Entry>> current{ bucket(level) };
+
+				for (usize i{ 0 }; i < current.size(); ++i) {
+					visitor(current[i], level, push);
+				}
+
+				pending -= current.size();
+				current.clear();
+
+				if (pending > 0) {
+					++level;
+				} else if (next_seed < seeds.size()) {
+					level = seeds[next_seed].distance;
+				} else {
+					break;
+				}
+			}
+		}
+	};
+
+	// distances left below one by negative goals are turned back into their magnitude, and those within one of zero into zero
+	template<Numeric D, extent_t Size, extent_t BorderSize, typename Layout> constexpr void homogenize(ref<zone_t<D, Size, BorderSize, Layout>> distances) noexcept {
+		for (usize i{ 0 }; i < Size.area(); ++i) {
+			const D distance{ distances[i] };
+
+			if (distance >= 1) {
+				continue;
+			}
+
+			distances[i] = (distance < 1 && distance > -1) ? 0 : std::abs(distance);
+		}
+	}
+} // namespace bleak
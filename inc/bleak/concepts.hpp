@@ -381,4 +381,12 @@ namespace bleak {
 	template<typename T> concept SparseBlockage = requires(T t, offset_t position) {
 		{ t.contains(position) } -> std::convertible_to<bool>;
 	};
+
+	template<typename T> concept Trackable = (std::is_integral<T>::value || std::is_enum<T>::value) && sizeof(T) == sizeof(u8);
+
+	template<typename T> struct is_trackable {
+		static constexpr bool value = Trackable<T>;
+	};
+
+	template<typename T> constexpr bool is_trackable_v = is_trackable<T>::value;
 } // namespace bleak
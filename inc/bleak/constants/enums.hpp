@@ -18,6 +18,16 @@ namespace bleak {
 		Melded
 	};
 
+	enum struct execution_e : u8 {
+		Sequential,
+		Parallel
+	};
+
+	enum struct field_method_e : u8 {
+		Dijkstra,
+		Chamfer
+	};
+
 	enum struct wave_e {
 		Sine,
 		Square,
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <bleak/log.hpp>
+#include <bleak/simd.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	namespace delta {
+		// unchanged stretches shorter than this are folded into the surrounding literal, as starting a new run costs at least two bytes
+		constexpr usize merge_gap{ 8 };
+
+		inline void write_varint(ref<std::vector<u8>> stream, usize value) noexcept {
+			while (value >= 0x80) {
+				stream.push_back(static_cast<u8>(value | 0x80));
+				value >>= 7;
+			}
+
+			stream.push_back(static_cast<u8>(value));
+		}
+
+		inline bool read_varint(std::span<const u8> stream, ref<usize> cursor, ref<usize> value) noexcept {
+			value = 0;
+
+			for (usize shift{ 0 }; shift < sizeof(usize) * 8; shift += 7) {
+				if (cursor >= stream.size()) {
+					return false;
+				}
+
+				const u8 byte{ stream[cursor++] };
+
+				value |= static_cast<usize>(byte & 0x7F) << shift;
+
+				if ((byte & 0x80) == 0) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// appends the byte count followed by runs of an unchanged length, a changed length and the changed bytes, which together turn the base into the current
+		inline void encode(cptr<u8> base, cptr<u8> current, usize count, ref<std::vector<u8>> stream) noexcept {
+			write_varint(stream, count);
+
+			usize i{ 0 };
+
+			while (i < count) {
+				const usize first{ i + simd::mismatch(base + i, current + i, count - i) };
+
+				if (first == count) {
+					break;
+				}
+
+				usize last{ first };
+
+				for (;;) {
+					last += simd::match(base + last, current + last, count - last);
+
+					const usize span{ min(merge_gap, count - last) };
+					const usize gap{ simd::mismatch(base + last, current + last, span) };
+
+					if (gap == span) {
+						break;
+					}
+
+					last += gap;
+				}
+
+				write_varint(stream, first - i);
+				write_varint(stream, last - first);
+
+				stream.insert(stream.end(), current + first, current + last);
+
+				i = last;
+			}
+		}
+
+		// invokes visitor(offset, literal, length) for every run, returning false if the stream was not encoded for the byte count or ends partway through a run
+		template<typename Visitor> inline bool traverse(std::span<const u8> stream, usize count, rval<Visitor> visitor) noexcept {
+			usize cursor{ 0 };
+			usize encoded{ 0 };
+
+			if (!read_varint(stream, cursor, encoded) || encoded != count) {
+				return false;
+			}
+
+			usize offset{ 0 };
+
+			while (cursor < stream.size()) {
+				usize skip{ 0 };
+				usize length{ 0 };
+
+				if (!read_varint(stream, cursor, skip) || !read_varint(stream, cursor, length)) {
+					return false;
+				}
+
+				if (skip > count - offset || length > count - offset - skip || length > stream.size() - cursor) {
+					return false;
+				}
+
+				offset += skip;
+
+				visitor(offset, stream.data() + cursor, length);
+
+				offset += length;
+				cursor += length;
+			}
+
+			return true;
+		}
+
+		// the whole stream is validated before the first byte of the target is written
+		inline bool decode(std::span<const u8> stream, ptr<u8> target, usize count) noexcept {
+			if (!traverse(stream, count, [](usize, cptr<u8>, usize) {})) {
+				error_log.add("[ERROR]: delta stream is malformed or was encoded for a different size.", __TIME_FILE_LINE__);
+				return false;
+			}
+
+			return traverse(stream, count, [&](usize offset, cptr<u8> literal, usize length) { std::memcpy(target + offset, literal, length); });
+		}
+	} // namespace delta
+} // namespace bleak
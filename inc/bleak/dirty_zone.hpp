@@ -0,0 +1,290 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+#include <bleak/array.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/utility.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// a zone that records which tiles have been written since they were last consumed, along with a revision that advances on every change; writes must go through the tracked interface
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero, extent_t Tile = extent_t{ 16, 16 }> struct dirty_zone_t {
+		static_assert(Tile > extent_t::Zero, "tile size must be greater than zero.");
+
+	  public:
+		using zone_type = zone_t<T, Size, BorderSize>;
+
+		static constexpr extent_t tile_size{ Tile };
+		static constexpr extent_t tile_count{ (Size + Tile - 1) / Tile };
+
+	  private:
+		zone_type zone;
+
+		array_t<bool, tile_count> flags;
+		std::vector<offset_t> pending;
+
+		u64 current_revision;
+
+		constexpr void mark(offset_t position) noexcept {
+			const offset_t tile{ position / Tile };
+
+			if (flags[tile]) {
+				return;
+			}
+
+			flags[tile] = true;
+			pending.push_back(tile);
+		}
+
+		// marks every tile overlapping the inclusive span of cells, clamped to the zone
+		constexpr void mark(offset_t origin, offset_t extent) noexcept {
+			if (origin.x > extent.x || origin.y > extent.y) {
+				return;
+			}
+
+			const offset_t first{ offset_t::clamp(origin, zone_type::zone_origin, zone_type::zone_extent) / Tile };
+			const offset_t last{ offset_t::clamp(extent, zone_type::zone_origin, zone_type::zone_extent) / Tile };
+
+			for (offset_t::scalar_t y{ first.y }; y <= last.y; ++y) {
+				for (offset_t::scalar_t x{ first.x }; x <= last.x; ++x) {
+					const offset_t tile{ x, y };
+
+					if (flags[tile]) {
+						continue;
+					}
+
+					flags[tile] = true;
+					pending.push_back(tile);
+				}
+			}
+		}
+
+		template<region_e Region> constexpr void mark() noexcept {
+			if constexpr (Region == region_e::All) {
+				mark(zone_type::zone_origin, zone_type::zone_extent);
+			} else if constexpr (Region == region_e::Interior) {
+				mark(zone_type::interior_origin, zone_type::interior_extent);
+			} else if constexpr (Region == region_e::Border) {
+				mark(zone_type::zone_origin, offset_t{ zone_type::zone_extent.x, zone_type::interior_origin.y - 1 });
+				mark(offset_t{ zone_type::zone_origin.x, zone_type::interior_extent.y + 1 }, zone_type::zone_extent);
+				mark(zone_type::zone_origin, offset_t{ zone_type::interior_origin.x - 1, zone_type::zone_extent.y });
+				mark(offset_t{ zone_type::interior_extent.x + 1, zone_type::zone_origin.y }, zone_type::zone_extent);
+			}
+
+			++current_revision;
+		}
+
+		// walks the same line as zone_t::linear_apply, marking the tile of every cell it may write
+		template<region_e Region> constexpr void mark_line(offset_t origin, offset_t target) noexcept {
+			if (!zone.template within<Region>(origin) || !zone.template within<Region>(target)) {
+				return;
+			}
+
+			const offset_t delta{ std::abs(target.x - origin.x), std::abs(target.y - origin.y) };
+
+			const offset_t step{ origin.x < target.x ? 1 : -1, origin.y < target.y ? 1 : -1 };
+
+			i32 err = delta.x - delta.y;
+
+			offset_t current_position{ origin };
+
+			mark(current_position);
+
+			while (current_position != target) {
+				i32 e2 = 2 * err;
+
+				if (e2 > -delta.y) {
+					err -= delta.y;
+					current_position.x += step.x;
+				}
+
+				if (e2 < delta.x) {
+					err += delta.x;
+					current_position.y += step.y;
+				}
+
+				if (!zone.template within<Region>(current_position)) {
+					break;
+				}
+
+				mark(current_position);
+			}
+
+			++current_revision;
+		}
+
+		constexpr void write(offset_t position, cref<T> value) noexcept {
+			if (zone[position] == value) {
+				return;
+			}
+
+			zone[position] = value;
+
+			mark(position);
+
+			++current_revision;
+		}
+
+	  public:
+		struct cell_t {
+		  private:
+			ref<dirty_zone_t> owner;
+			offset_t position;
+
+		  public:
+			constexpr cell_t(ref<dirty_zone_t> owner, offset_t position) noexcept : owner{ owner }, position{ position } {}
+
+			constexpr operator T() const noexcept { return owner.zone[position]; }
+
+			constexpr ref<cell_t> operator=(cref<T> value) noexcept {
+				owner.write(position, value);
+
+				return *this;
+			}
+
+			constexpr ref<cell_t> operator=(cref<cell_t> other) noexcept {
+				owner.write(position, static_cast<T>(other));
+
+				return *this;
+			}
+		};
+
+		constexpr dirty_zone_t() noexcept : zone{}, flags{}, pending{}, current_revision{ 0 } {}
+
+		constexpr explicit dirty_zone_t(cref<zone_type> other) noexcept : zone{ other }, flags{}, pending{}, current_revision{ 0 } {}
+
+		constexpr explicit dirty_zone_t(rval<zone_type> other) noexcept : zone{ std::move(other) }, flags{}, pending{}, current_revision{ 0 } {}
+
+		constexpr dirty_zone_t(cref<dirty_zone_t> other) noexcept : zone{ other.zone }, flags{ other.flags }, pending{ other.pending }, current_revision{ other.current_revision } {}
+
+		constexpr dirty_zone_t(rval<dirty_zone_t> other) noexcept : zone{ std::move(other.zone) }, flags{ std::move(other.flags) }, pending{ std::move(other.pending) }, current_revision{ other.current_revision } {}
+
+		constexpr ref<dirty_zone_t> operator=(cref<dirty_zone_t> other) noexcept {
+			if (this != &other) {
+				zone = other.zone;
+				flags = other.flags;
+				pending = other.pending;
+				current_revision = other.current_revision;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<dirty_zone_t> operator=(rval<dirty_zone_t> other) noexcept {
+			if (this != &other) {
+				zone = std::move(other.zone);
+				flags = std::move(other.flags);
+				pending = std::move(other.pending);
+				current_revision = other.current_revision;
+			}
+
+			return *this;
+		}
+
+		constexpr ~dirty_zone_t() noexcept {}
+
+		constexpr cref<zone_type> get() const noexcept { return zone; }
+
+		constexpr operator cref<zone_type>() const noexcept { return zone; }
+
+		constexpr cell_t operator[](offset_t position) noexcept { return cell_t{ *this, position }; }
+
+		constexpr cref<T> operator[](offset_t position) const noexcept { return zone[position]; }
+
+		constexpr cell_t operator[](extent_t::scalar_t x, extent_t::scalar_t y) noexcept { return cell_t{ *this, offset_t{ x, y } }; }
+
+		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return zone[x, y]; }
+
+		// advances on every change, so consumers may compare it against the revision they last saw instead of consuming
+		constexpr u64 revision() const noexcept { return current_revision; }
+
+		constexpr bool is_dirty() const noexcept { return !pending.empty(); }
+
+		constexpr bool is_dirty(offset_t position) const noexcept { return flags[position / Tile]; }
+
+		// appends one rectangle per dirty tile to the output and clears them; only the dirty tiles are visited
+		constexpr void consume_dirty(ref<std::vector<rect_t>> rects) noexcept {
+			rects.reserve(rects.size() + pending.size());
+
+			for (crauto tile : pending) {
+				flags[tile] = false;
+
+				const offset_t origin{ tile * Tile };
+
+				rects.emplace_back(origin, extent_t{ min<extent_t::scalar_t>(Tile.w, Size.w - origin.x), min<extent_t::scalar_t>(Tile.h, Size.h - origin.y) });
+			}
+
+			pending.clear();
+		}
+
+		constexpr std::vector<rect_t> consume_dirty() noexcept {
+			std::vector<rect_t> rects{};
+
+			consume_dirty(rects);
+
+			return rects;
+		}
+
+		// marks the entire zone as dirty, such as after a write that bypassed the tracked interface
+		constexpr void invalidate() noexcept { mark<region_e::All>(); }
+
+		template<region_e Region, typename U> constexpr ref<dirty_zone_t> set(cref<U> value) noexcept {
+			zone.template set<Region>(value);
+			mark<Region>();
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<dirty_zone_t> reset() noexcept {
+			zone.template reset<Region>();
+			mark<Region>();
+
+			return *this;
+		}
+
+		template<region_e Region, typename... Params> constexpr ref<dirty_zone_t> apply(cref<Params>... values) noexcept {
+			zone.template apply<Region>(values...);
+			mark<Region>();
+
+			return *this;
+		}
+
+		template<region_e Region, typename... Params> constexpr ref<dirty_zone_t> repeal(cref<Params>... values) noexcept {
+			zone.template repeal<Region>(values...);
+			mark<Region>();
+
+			return *this;
+		}
+
+		template<region_e Region, typename U> constexpr void linear_apply(offset_t origin, offset_t target, cref<U> value) noexcept {
+			zone.template linear_apply<Region>(origin, target, value);
+			mark_line<Region>(origin, target);
+		}
+
+		constexpr void swap(ref<array_t<T, Size>> buffer) noexcept {
+			zone.swap(buffer);
+			invalidate();
+		}
+
+		constexpr void sync(cref<array_t<T, Size>> buffer) noexcept {
+			zone.sync(buffer);
+			invalidate();
+		}
+
+		// runs an arbitrary bulk operation against the underlying zone, such as generate or automatize, and then marks the region it was confined to
+		template<region_e Region, typename Mutator> constexpr ref<dirty_zone_t> modify(rval<Mutator> mutator) noexcept {
+			mutator(zone);
+			mark<Region>();
+
+			return *this;
+		}
+	};
+} // namespace bleak
@@ -2,34 +2,57 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
+#include <array>
 #include <expected>
 #include <optional>
 #include <queue>
+#include <span>
+#include <type_traits>
+#include <vector>
 
+#include <bleak/bucket_queue.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/sparse.hpp>
 #include <bleak/random.hpp>
+#include <bleak/thread_pool.hpp>
 #include <bleak/zone.hpp>
 
+#include <bleak/constants/enums.hpp>
+
 namespace bleak {
 	enum struct marker_e : u8 {
 		Obstacle,
 		Goal
 	};
 
-	template<Numeric D, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder> struct field_t {
+	template<Numeric D, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder, typename Layout = row_major_layout_t> struct field_t {
 	  private:
-		template<typename T> using zone_t = zone_t<T, ZoneSize, ZoneBorder>;
+		template<typename T> using zone_t = zone_t<T, ZoneSize, ZoneBorder, Layout>;
 
 		zone_t<D> distances;
 		sparse_t<D> goals;
 
+		static constexpr usize visited_words{ (static_cast<usize>(ZoneSize.area()) + 63) / 64 };
+
+		// scratch for integral recalculation, kept between calls so that it is only allocated once per field
+		std::vector<u64> visited_bits;
+		std::vector<creeper_t<D>> seeds;
+		bucket_queue_t<D, DistanceFunction, offset_t> buckets;
+		std::vector<offset_t> invalidated;
+		std::vector<D> raster;
+		std::vector<u8> raster_open;
+
 		using return_t = std::expected<D, marker_e>;
 		using error_t = return_t::unexpected_type;
 
+		// any zone-like source may be read for the field, so long as it spans the cells and borders of the field
+		template<typename Zone> static constexpr bool spans{ Zone::zone_size == ZoneSize && Zone::border_size == ZoneBorder };
+
 	  public:
 		static constexpr D goal_value{ 0 };
 		static constexpr D obstacle_value{ ZoneSize.area() };
@@ -53,33 +76,33 @@ namespace bleak {
 
 		constexpr bool obstacle_reached(offset_t position, D threshold) const noexcept { return distances[position] >= close_to_obstacle_value - threshold; }
 
-		constexpr field_t() noexcept : distances{}, goals{} { clear<region_e::All>(); }
+		constexpr field_t() noexcept : distances{}, goals{}, visited_bits{}, seeds{}, buckets{}, invalidated{}, raster{}, raster_open{} { clear<region_e::All>(); }
 
 		template<typename... Goals>
 			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
+		constexpr field_t(cref<Goals>... goals) noexcept : distances{}, goals{ goals... }, visited_bits{}, seeds{}, buckets{}, invalidated{}, raster{}, raster_open{} {
 			clear<region_e::All>();
 		}
 
 		template<typename T, typename... Goals>
 			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(cref<zone_t<T>> zone, cref<T> value, cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
+		constexpr field_t(cref<zone_t<T>> zone, cref<T> value, cref<Goals>... goals) noexcept : distances{}, goals{ goals... }, visited_bits{}, seeds{}, buckets{}, invalidated{}, raster{}, raster_open{} {
 			recalculate<region_e::All>(zone, value);
 		}
 
 		template<typename... Goals>
 			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
+		constexpr field_t(rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) }, visited_bits{}, seeds{}, buckets{}, invalidated{}, raster{}, raster_open{} {
 			clear<region_e::All>();
 		}
 
 		template<region_e Region, typename T, typename... Goals>
 			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(cref<zone_t<T>> zone, cref<T> value, rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
+		constexpr field_t(cref<zone_t<T>> zone, cref<T> value, rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) }, visited_bits{}, seeds{}, buckets{}, invalidated{}, raster{}, raster_open{} {
 			recalculate<region_e::All>(zone, value);
 		}
 
-		template<region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> clear() noexcept {
+		template<region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> clear() noexcept {
 			distances.dependent set<Region>(obstacle_value);
 
 			if constexpr (Region == region_e::All) {
@@ -165,141 +188,202 @@ namespace bleak {
 
 		constexpr D average(offset_t position) const noexcept { return average<region_e::All>(position); }
 
-		constexpr void homogenize() noexcept {
-			for (usize i{ 0 }; i < ZoneSize.area(); ++i) {
-				const D distance{ distances[i] };
+		constexpr void homogenize() noexcept { bleak::homogenize(distances); }
 
-				if (distance >= 1) {
-					continue;
-				}
+	  private:
+		static constexpr usize visited_index(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(ZoneSize.w) + static_cast<usize>(position.x); }
 
-				distances[i] = (distance < 1 && distance > -1) ? 0 : std::abs(distance);
-			}
+		constexpr bool is_visited(offset_t position) const noexcept {
+			const usize index{ visited_index(position) };
+
+			return (visited_bits[index / 64] >> (index % 64)) & 1;
 		}
 
-		template<region_e Region, typename T> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T>> zone, cref<T> value) noexcept {
-			distances.dependent set<Region>(obstacle_value);
+		constexpr void visit(offset_t position) noexcept {
+			const usize index{ visited_index(position) };
 
-			if (goals.empty()) {
-				return *this;
+			visited_bits[index / 64] |= u64{ 1 } << (index % 64);
+		}
+
+		// pops every cell from the seeds onward in order of distance, as visitor(position, distance, push)
+		template<typename Visitor> constexpr void drain(rval<Visitor> visitor) noexcept {
+			buckets.drain(seeds, [](cref<creeper_t<D>> seed) -> offset_t { return seed.position; }, std::forward<Visitor>(visitor));
+		}
+
+		// whether a path may step into the position; goals are sources whether or not they are blocked
+		template<region_e Region, typename Zone, typename U, typename Blocked> static constexpr bool enterable(cref<Zone> zone, cref<U> value, cref<Blocked> blocked, offset_t position) noexcept {
+			return zone.dependent within<Region>(position) && zone[position] == value && !blocked(position);
+		}
+
+		template<region_e Region, typename Zone, typename U> constexpr D source(cref<Zone> zone, cref<U> value, offset_t position) const noexcept {
+			if (!zone.dependent within<Region>(position) || zone[position] != value) {
+				return obstacle_value;
 			}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+			cptr<D> goal{ goals[position] };
 
-			bool negative_goal{ false };
+			return goal != nullptr ? *goal : obstacle_value;
+		}
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
-				}
+		// the distance the position would take from its neighbours and its own goal as they currently stand
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr D lookahead(cref<Zone> zone, cref<U> value, cref<Blocked> blocked, offset_t position) const noexcept {
+			D best{ source<Region>(zone, value, position) };
 
-				frontier.emplace(g_pos, g_val);
+			if (!enterable<Region>(zone, value, blocked, position)) {
+				return best;
+			}
 
-				if (g_val < 0) {
-					negative_goal = true;
+			for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+				const offset_t offset_position{ position + creeper.position };
+
+				if (!distances.dependent within<Region>(offset_position) || is_obstacle(distances[offset_position])) {
+					continue;
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				best = min(best, static_cast<D>(distances[offset_position] + creeper.distance));
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			return best;
+		}
+
+		// lowers every cell reachable from the seeds, each of which must already hold its seeded distance; a cell is only expanded once, at its final distance
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr void relax(cref<Zone> zone, cref<U> value, cref<Blocked> blocked) noexcept {
+			visited_bits.assign(visited_words, 0);
 
-				visited.insert(current.position);
+			const auto expand{ [&](offset_t position, D level, crauto push) {
+				if (is_visited(position) || distances[position] != level) {
+					return;
+				}
 
-				distances[current.position] = current.distance;
+				visit(position);
 
-				for (cauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					const offset_t offset_position{ current.position + creeper.position };
+				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+					const offset_t offset_position{ position + creeper.position };
 
-					if (visited.contains(offset_position) || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value) {
-						if (!visited.contains(offset_position)) {
-							visited.insert(offset_position);
-						}
+					if (!enterable<Region>(zone, value, blocked, offset_position)) {
+						continue;
+					}
+
+					const D distance{ static_cast<D>(level + creeper.distance) };
 
+					if (distance >= distances[offset_position]) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					distances[offset_position] = distance;
+
+					push(offset_position, distance);
 				}
-			}
+			} };
 
-			if (negative_goal) {
-				homogenize();
-			}
+			if constexpr (std::is_integral<D>::value) {
+				drain(expand);
+			} else {
+				// non-integral steps cannot index a ring of buckets, so the frontier is a heap ordered the same way
+				std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{ typename creeper_t<D>::less{}, seeds };
 
-			return *this;
-		}
+				const auto push{ [&](offset_t position, D distance) { frontier.emplace(position, distance); } };
 
-		template<region_e Region, typename T, typename U>
-			requires is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T>> zone, cref<U> value) noexcept {
-			distances.dependent set<Region>(obstacle_value);
+				while (!frontier.empty()) {
+					const creeper_t<D> current{ frontier.top() };
+					frontier.pop();
 
-			if (goals.empty()) {
-				return *this;
+					expand(current.position, current.distance, push);
+				}
 			}
+		}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+		// the shortest distance from any goal, for integral and non-integral fields alike; a goal takes a shorter distance from a nearer goal if there is one, and negative goals are homogenized afterwards
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr void propagate(cref<Zone> zone, cref<U> value, rval<Blocked> blocked) noexcept {
+			seeds.clear();
 
 			bool negative_goal{ false };
 
 			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
+				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value || g_val >= distances[g_pos]) {
 					continue;
 				}
 
-				frontier.emplace(g_pos, g_val);
+				distances[g_pos] = g_val;
+
+				seeds.emplace_back(g_pos, g_val);
 
 				if (g_val < 0) {
 					negative_goal = true;
 				}
 			}
 
-			if (frontier.empty()) {
-				return *this;
+			relax<Region>(zone, value, blocked);
+
+			if (negative_goal) {
+				homogenize();
 			}
+		}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+		static constexpr usize raster_stride{ static_cast<usize>(ZoneSize.w) + 2 };
+		static constexpr usize raster_area{ raster_stride * (static_cast<usize>(ZoneSize.h) + 2) };
 
-				visited.insert(current.position);
+		static constexpr usize raster_index(offset_t position) noexcept { return (static_cast<usize>(position.y) + 1) * raster_stride + static_cast<usize>(position.x) + 1; }
 
-				distances[current.position] = current.distance;
+		// pairs of raster sweeps after which a field that has not settled is left to dial's algorithm instead
+		static constexpr usize maximum_sweeps{ 4 };
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+		// relaxes every cell of a row against the row before it in the direction of the sweep and then against the cell before it; the first loop carries no dependency between cells, so only the second is serial
+		template<bool Forward> constexpr bool sweep_row(extent_t::scalar_t y) noexcept {
+			constexpr bool diagonal{ DistanceFunction != distance_function_e::VonNeumann && DistanceFunction != distance_function_e::Manhattan };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value) {
-						continue;
-					}
+			constexpr D step{ 1 };
+
+			const usize w{ static_cast<usize>(ZoneSize.w) };
+
+			ptr<D> row{ raster.data() + raster_index(offset_t{ 0, y }) };
+			cptr<D> previous{ Forward ? row - raster_stride : row + raster_stride };
+			cptr<u8> open{ raster_open.data() + raster_index(offset_t{ 0, y }) };
+
+			bool changed{ false };
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+			for (usize x{ 0 }; x < w; ++x) {
+				D best{ static_cast<D>(previous[x] + step) };
+
+				if constexpr (diagonal) {
+					best = min(best, static_cast<D>(min(previous[x - 1], previous[x + 1]) + step));
 				}
+
+				const D relaxed{ open[x] && best < row[x] ? best : row[x] };
+
+				changed |= relaxed != row[x];
+				row[x] = relaxed;
 			}
 
-			if (negative_goal) {
-				homogenize();
+			// the running value is carried in a register rather than reloaded from the row just stored
+			D carry{ Forward ? row[-1] : row[w] };
+
+			for (usize i{ 0 }; i < w; ++i) {
+				const usize x{ Forward ? i : w - 1 - i };
+
+				const D through{ static_cast<D>(carry + step) };
+				const D relaxed{ open[x] && through < row[x] ? through : row[x] };
+
+				changed |= relaxed != row[x];
+				row[x] = relaxed;
+				carry = relaxed;
 			}
 
-			return *this;
+			return changed;
 		}
 
-		template<region_e Region, typename T, SparseBlockage Blockage> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T>> zone, cref<T> value, cref<Blockage> blockage) noexcept {
-			distances.dependent set<Region>(obstacle_value);
+		// copies the field into the padded raster with every goal seeded and marks the cells that may be entered; returns whether any goal is negative
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr bool rasterize(cref<Zone> zone, cref<U> value, cref<Blocked> blocked) noexcept {
+			raster.assign(raster_area, obstacle_value);
+			raster_open.assign(raster_area, 0);
 
-			if (goals.empty()) {
-				return *this;
-			}
+			for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+					raster_open[raster_index(position)] = enterable<Region>(zone, value, blocked, position);
+				}
+			}
 
 			bool negative_goal{ false };
 
@@ -308,209 +392,438 @@ namespace bleak {
 					continue;
 				}
 
-				frontier.emplace(g_pos, g_val);
+				raster[raster_index(g_pos)] = min(raster[raster_index(g_pos)], g_val);
 
 				if (g_val < 0) {
 					negative_goal = true;
 				}
 			}
 
-			if (frontier.empty()) {
-				return *this;
+			return negative_goal;
+		}
+
+		template<region_e Region> constexpr void unrasterize(bool negative_goal) noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
+
+					if (distances.dependent within<Region>(position)) {
+						distances[position] = raster[raster_index(position)];
+					}
+				}
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			if (negative_goal) {
+				homogenize();
+			}
+		}
 
-				visited.insert(current.position);
+		// sweeps the rows in [first, last) forwards and backwards until they settle or the pairs run out; returns whether any cell changed
+		constexpr bool sweep_rows(extent_t::scalar_t first, extent_t::scalar_t last) noexcept {
+			bool changed{ false };
 
-				distances[current.position] = current.distance;
+			for (usize i{ 0 }; i < maximum_sweeps; ++i) {
+				bool swept{ false };
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+				for (extent_t::scalar_t y{ first }; y < last; ++y) {
+					swept |= sweep_row<true>(y);
+				}
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || blockage.contains(offset_position)) {
-						continue;
-					}
+				for (extent_t::scalar_t y{ last }; y-- > first;) {
+					swept |= sweep_row<false>(y);
+				}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+				if (!swept) {
+					break;
 				}
-			}
 
-			if (negative_goal) {
-				homogenize();
+				changed = true;
 			}
 
-			return *this;
+			return changed;
 		}
 
-		template<region_e Region, typename T, typename U, SparseBlockage Blockage>
-			requires is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T>> zone, cref<U> value, cref<Blockage> sparse_blockage) noexcept {
-			distances.dependent set<Region>(obstacle_value);
+		// the chamfer distance transform over a padded copy of the field; since integral steps are all of one, repeated forward and backward sweeps settle on exactly the distances of dial's algorithm
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr void chamfer(cref<Zone> zone, cref<U> value, rval<Blocked> blocked) noexcept {
+			const bool negative_goal{ rasterize<Region>(zone, value, blocked) };
 
-			if (goals.empty()) {
-				return *this;
-			}
+			bool settled{ false };
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+			for (usize i{ 0 }; i < maximum_sweeps && !settled; ++i) {
+				bool changed{ false };
 
-			bool negative_goal{ false };
+				for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+					changed |= sweep_row<true>(y);
+				}
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
+				for (extent_t::scalar_t y{ ZoneSize.h }; y-- > 0;) {
+					changed |= sweep_row<false>(y);
 				}
 
-				frontier.emplace(g_pos, g_val);
+				settled = !changed;
+			}
 
-				if (g_val < 0) {
-					negative_goal = true;
+			if (!settled) {
+				propagate<Region>(zone, value, blocked);
+				return;
+			}
+
+			unrasterize<Region>(negative_goal);
+		}
+
+		// rounds of the banded transform after which a field that has not settled is left to dial's algorithm instead; fixed, so that the work spent before falling back does not grow with the thread count
+		static constexpr usize maximum_rounds{ 16 };
+
+		// the chamfer transform split into bands of rows across the thread pool; even and odd bands take turns, so that a band only ever reads the edge rows of neighbours that are idle, and the rounds repeat until no band changes. the fixed point is the same as that of the serial sweeps
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr void wavefront(cref<Zone> zone, cref<U> value, rval<Blocked> blocked) noexcept {
+			const bool negative_goal{ rasterize<Region>(zone, value, blocked) };
+
+			ref<thread_pool_t> pool{ thread_pool_t::instance() };
+
+			const usize band_count{ clamp<usize>(pool.concurrency() * 2, 2, static_cast<usize>(ZoneSize.h)) };
+
+			const auto band_row = [&](usize band) -> extent_t::scalar_t { return extent_t::scalar_cast(static_cast<usize>(ZoneSize.h) * band / band_count); };
+
+			std::vector<u8> changed(band_count, 0);
+
+			bool settled{ false };
+
+			for (usize round{ 0 }; round < maximum_rounds && !settled; ++round) {
+				for (usize parity{ 0 }; parity < 2; ++parity) {
+					pool.dispatch((band_count + 1 - parity) / 2, [&](usize i) {
+						const usize band{ i * 2 + parity };
+
+						changed[band] = sweep_rows(band_row(band), band_row(band + 1));
+					});
 				}
+
+				settled = std::find(changed.begin(), changed.end(), u8{ 1 }) == changed.end();
 			}
 
-			if (frontier.empty()) {
-				return *this;
+			if (!settled) {
+				propagate<Region>(zone, value, blocked);
+				return;
+			}
+
+			unrasterize<Region>(negative_goal);
+		}
+
+		// invalidates every cell whose distance no longer has support, in order of distance so that each cell is judged after all of its supporters, and then lowers the invalidated and changed cells back from their surroundings
+		template<region_e Region, typename Zone, typename U, typename Blocked> constexpr void mend(cref<Zone> zone, cref<U> value, std::span<const offset_t> changed, rval<Blocked> blocked) noexcept {
+			visited_bits.assign(visited_words, 0);
+			seeds.clear();
+			invalidated.clear();
+
+			for (cauto position : changed) {
+				if (distances.dependent within<Region>(position) && !is_obstacle(distances[position])) {
+					seeds.emplace_back(position, distances[position]);
+				}
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			drain([&](offset_t position, D level, crauto push) {
+				if (is_visited(position)) {
+					return;
+				}
 
-				visited.insert(current.position);
+				if (source<Region>(zone, value, position) <= level) {
+					return;
+				}
 
-				distances[current.position] = current.distance;
+				if (enterable<Region>(zone, value, blocked, position)) {
+					for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+						const offset_t offset_position{ position + creeper.position };
+
+						if (!distances.dependent within<Region>(offset_position) || is_visited(offset_position) || is_obstacle(distances[offset_position])) {
+							continue;
+						}
+
+						if (distances[offset_position] + creeper.distance <= level) {
+							return;
+						}
+					}
+				}
+
+				visit(position);
+				invalidated.push_back(position);
 
 				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+					const offset_t offset_position{ position + creeper.position };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || sparse_blockage.contains(offset_position)) {
+					if (!distances.dependent within<Region>(offset_position) || is_visited(offset_position)) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					const D distance{ static_cast<D>(level + creeper.distance) };
+
+					if (distances[offset_position] == distance) {
+						push(offset_position, distance);
+					}
 				}
+			});
+
+			for (cauto position : invalidated) {
+				distances[position] = obstacle_value;
 			}
 
-			if (negative_goal) {
-				homogenize();
+			seeds.clear();
+
+			const auto reconsider{ [&](offset_t position) {
+				if (!distances.dependent within<Region>(position)) {
+					return;
+				}
+
+				const D distance{ lookahead<Region>(zone, value, blocked, position) };
+
+				if (distance >= distances[position]) {
+					return;
+				}
+
+				distances[position] = distance;
+
+				seeds.emplace_back(position, distance);
+			} };
+
+			for (cauto position : changed) {
+				reconsider(position);
 			}
 
-			return *this;
+			for (cauto position : invalidated) {
+				reconsider(position);
+			}
+
+			relax<Region>(zone, value, blocked);
 		}
 
-		template<region_e Region, typename T, SparseBlockage... Blockages>
-			requires is_plurary<Blockages...>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T>> zone, cref<T> value, cref<Blockages>... blockages) noexcept {
+	  public:
+		template<region_e Region, ZoneLike Zone>
+			requires spans<Zone>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<typename Zone::value_type> value) noexcept {
 			distances.dependent set<Region>(obstacle_value);
 
 			if (goals.empty()) {
 				return *this;
 			}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
-
-			bool negative_goal{ false };
+			propagate<Region>(zone, value, [](offset_t) -> bool { return false; });
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
-				}
+			return *this;
+		}
 
-				frontier.emplace(g_pos, g_val);
+		template<region_e Region, ZoneLike Zone, typename U>
+			requires spans<Zone> && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<U> value) noexcept {
+			distances.dependent set<Region>(obstacle_value);
 
-				if (g_val < 0) {
-					negative_goal = true;
-				}
+			if (goals.empty()) {
+				return *this;
 			}
 
-			if (frontier.empty()) {
+			propagate<Region>(zone, value, [](offset_t) -> bool { return false; });
+
+			return *this;
+		}
+
+		template<region_e Region, ZoneLike Zone, SparseBlockage Blockage>
+			requires spans<Zone>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<typename Zone::value_type> value, cref<Blockage> blockage) noexcept {
+			distances.dependent set<Region>(obstacle_value);
+
+			if (goals.empty()) {
 				return *this;
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return blockage.contains(position); });
 
-				visited.insert(current.position);
+			return *this;
+		}
 
-				distances[current.position] = current.distance;
+		template<region_e Region, ZoneLike Zone, typename U, SparseBlockage Blockage>
+			requires spans<Zone> && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<U> value, cref<Blockage> sparse_blockage) noexcept {
+			distances.dependent set<Region>(obstacle_value);
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+			if (goals.empty()) {
+				return *this;
+			}
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || (blockages.contains(offset_position) || ...)) {
-						continue;
-					}
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return sparse_blockage.contains(position); });
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
-				}
-			}
+			return *this;
+		}
 
-			if (negative_goal) {
-				homogenize();
+		template<region_e Region, ZoneLike Zone, SparseBlockage... Blockages>
+			requires spans<Zone> && is_plurary<Blockages...>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<typename Zone::value_type> value, cref<Blockages>... blockages) noexcept {
+			distances.dependent set<Region>(obstacle_value);
+
+			if (goals.empty()) {
+				return *this;
 			}
 
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+
 			return *this;
 		}
 
-		template<region_e Region, typename T, typename U, SparseBlockage... Blockages>
-			requires is_plurary<Blockages...>::value && is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T>> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
+		template<region_e Region, ZoneLike Zone, typename U, SparseBlockage... Blockages>
+			requires spans<Zone> && is_plurary<Blockages...>::value && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
 			distances.dependent set<Region>(obstacle_value);
 
 			if (goals.empty()) {
 				return *this;
 			}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
 
-			bool negative_goal{ false };
+			return *this;
+		}
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
+		// chamfer recalculation of integral fields, which settles in a handful of linear raster sweeps on open maps and hands over to dial's algorithm on maps too winding to settle; non-integral fields are recalculated as usual
+		template<region_e Region, field_method_e Method, ZoneLike Zone, SparseBlockage... Blockages>
+			requires spans<Zone>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<typename Zone::value_type> value, cref<Blockages>... blockages) noexcept {
+			if constexpr (Method == field_method_e::Dijkstra || !std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value, blockages...);
+			} else {
+				distances.dependent set<Region>(obstacle_value);
+
+				if (goals.empty()) {
+					return *this;
 				}
 
-				frontier.emplace(g_pos, g_val);
+				chamfer<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
 
-				if (g_val < 0) {
-					negative_goal = true;
+				return *this;
+			}
+		}
+
+		template<region_e Region, field_method_e Method, ZoneLike Zone, typename U, SparseBlockage... Blockages>
+			requires spans<Zone> && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
+			if constexpr (Method == field_method_e::Dijkstra || !std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value, blockages...);
+			} else {
+				distances.dependent set<Region>(obstacle_value);
+
+				if (goals.empty()) {
+					return *this;
 				}
+
+				chamfer<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+
+				return *this;
 			}
+		}
+
+		// recalculation of integral fields across the thread pool, for zones large enough that a single thread becomes the bottleneck; the distances are the same as those of the serial path, which sequential execution and non-integral fields fall back to
+		template<region_e Region, execution_e Execution, ZoneLike Zone, SparseBlockage... Blockages>
+			requires spans<Zone>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<typename Zone::value_type> value, cref<Blockages>... blockages) noexcept {
+			if constexpr (Execution == execution_e::Sequential || !std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value, blockages...);
+			} else {
+				distances.dependent set<Region>(obstacle_value);
+
+				if (goals.empty()) {
+					return *this;
+				}
+
+				wavefront<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
 
-			if (frontier.empty()) {
 				return *this;
 			}
+		}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+		template<region_e Region, execution_e Execution, ZoneLike Zone, typename U, SparseBlockage... Blockages>
+			requires spans<Zone> && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<Zone> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
+			if constexpr (Execution == execution_e::Sequential || !std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value, blockages...);
+			} else {
+				distances.dependent set<Region>(obstacle_value);
 
-				visited.insert(current.position);
+				if (goals.empty()) {
+					return *this;
+				}
 
-				distances[current.position] = current.distance;
+				wavefront<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+				return *this;
+			}
+		}
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || (blockages.contains(offset_position) || ...)) {
-						continue;
+		// brings the field up to date after goals are added, removed or moved or cells of the zone or blockages change, given every cell that changed since the field was last calculated; only the cells whose distance improves or loses its support are visited. fields of non-integral distances or with negative goals are recalculated in full, which settles on the same distances
+		template<region_e Region, ZoneLike Zone>
+			requires spans<Zone>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> repair(cref<Zone> zone, cref<typename Zone::value_type> value, std::span<const offset_t> changed) noexcept {
+			if constexpr (!std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value);
+			} else {
+				for (crauto [_, g_val] : goals) {
+					if (g_val < 0) {
+						return recalculate<Region>(zone, value);
 					}
+				}
+
+				mend<Region>(zone, value, changed, [](offset_t) -> bool { return false; });
+
+				return *this;
+			}
+		}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+		template<region_e Region, ZoneLike Zone, typename U>
+			requires spans<Zone> && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> repair(cref<Zone> zone, cref<U> value, std::span<const offset_t> changed) noexcept {
+			if constexpr (!std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value);
+			} else {
+				for (crauto [_, g_val] : goals) {
+					if (g_val < 0) {
+						return recalculate<Region>(zone, value);
+					}
 				}
+
+				mend<Region>(zone, value, changed, [](offset_t) -> bool { return false; });
+
+				return *this;
 			}
+		}
 
-			if (negative_goal) {
-				homogenize();
+		template<region_e Region, ZoneLike Zone, SparseBlockage... Blockages>
+			requires spans<Zone> && (sizeof...(Blockages) > 0)
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> repair(cref<Zone> zone, cref<typename Zone::value_type> value, std::span<const offset_t> changed, cref<Blockages>... blockages) noexcept {
+			if constexpr (!std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value, blockages...);
+			} else {
+				for (crauto [_, g_val] : goals) {
+					if (g_val < 0) {
+						return recalculate<Region>(zone, value, blockages...);
+					}
+				}
+
+				mend<Region>(zone, value, changed, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+
+				return *this;
 			}
+		}
 
-			return *this;
+		template<region_e Region, ZoneLike Zone, typename U, SparseBlockage... Blockages>
+			requires spans<Zone> && (sizeof...(Blockages) > 0) && is_zone_comparable<Zone, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, Layout>> repair(cref<Zone> zone, cref<U> value, std::span<const offset_t> changed, cref<Blockages>... blockages) noexcept {
+			if constexpr (!std::is_integral<D>::value) {
+				return recalculate<Region>(zone, value, blockages...);
+			} else {
+				for (crauto [_, g_val] : goals) {
+					if (g_val < 0) {
+						return recalculate<Region>(zone, value, blockages...);
+					}
+				}
+
+				mend<Region>(zone, value, changed, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+
+				return *this;
+			}
 		}
 
 		template<region_e Region> constexpr std::optional<offset_t> ascend(offset_t position) const noexcept {
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <bit>
+
+#include <bleak/extent.hpp>
+#include <bleak/leaf.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// cells are stored row after row; the only layout whose rows are contiguous in memory
+	struct row_major_layout_t {
+		static constexpr bool contiguous_rows{ true };
+
+		template<typename T, usize Capacity> using container_t = std::array<T, Capacity>;
+
+		template<extent_t Size> static constexpr usize capacity{ static_cast<usize>(Size.size()) };
+
+		template<extent_t Size> static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return static_cast<usize>(j) * Size.w + i; }
+	};
+
+	// cells are grouped into row-major tiles which are themselves stored row-major, keeping vertical and diagonal neighbours within the same few cache lines
+	template<extent_t Tile = extent_t{ 8, 8 }> struct tiled_layout_t {
+		static_assert(Tile > extent_t::Zero, "tile size must be greater than zero.");
+
+		static constexpr bool contiguous_rows{ false };
+
+		template<typename T, usize Capacity> using container_t = std::array<T, Capacity>;
+
+		static constexpr extent_t tile_size{ Tile };
+
+		template<extent_t Size> static constexpr usize tiles_across{ (static_cast<usize>(Size.w) + Tile.w - 1) / Tile.w };
+
+		template<extent_t Size> static constexpr usize tiles_down{ (static_cast<usize>(Size.h) + Tile.h - 1) / Tile.h };
+
+		template<extent_t Size> static constexpr usize capacity{ tiles_across<Size> * tiles_down<Size> * static_cast<usize>(Tile.size()) };
+
+		template<extent_t Size> static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept {
+			const usize x{ static_cast<usize>(i) };
+			const usize y{ static_cast<usize>(j) };
+
+			const usize tile{ (y / Tile.h) * tiles_across<Size> + x / Tile.w };
+
+			return tile * Tile.size() + (y % Tile.h) * Tile.w + x % Tile.w;
+		}
+	};
+
+	// cells are stored along a z-order curve over the smallest enclosing power-of-two square
+	struct morton_layout_t {
+		static constexpr bool contiguous_rows{ false };
+
+		template<typename T, usize Capacity> using container_t = std::array<T, Capacity>;
+
+		template<extent_t Size> static constexpr usize side{ std::bit_ceil(static_cast<usize>(max(Size.w, Size.h))) };
+
+		template<extent_t Size> static constexpr usize capacity{ side<Size> * side<Size> };
+
+		template<extent_t Size> static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept {
+			return interleave<u32>(static_cast<u16>(i), static_cast<u16>(j));
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <optional>
+#include <queue>
+#include <type_traits>
+#include <vector>
+
+#include <bleak/bucket_queue.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/creeper.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/sparse.hpp>
+#include <bleak/utility.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// several fields over the same zone and passability, each with its own goals, calculated together in a single traversal; every popped cell generates and tests its neighbours once for all of the channels that are still being lowered through it
+	template<Numeric D, usize Channels, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder, typename Layout = row_major_layout_t> struct multi_field_t {
+		static_assert(Channels > 0 && Channels <= 64, "multi field must have between one and sixty-four channels!");
+
+	  private:
+		template<typename T> using zone_t = zone_t<T, ZoneSize, ZoneBorder, Layout>;
+
+		using mask_t = std::conditional_t<Channels <= 8, u8, std::conditional_t<Channels <= 16, u16, std::conditional_t<Channels <= 32, u32, u64>>>;
+
+		struct wave_t {
+			offset_t position;
+			mask_t channels;
+		};
+
+		struct front_t {
+			D distance;
+			offset_t position;
+			mask_t channels;
+
+			struct greater {
+				static constexpr bool operator()(cref<front_t> lhs, cref<front_t> rhs) noexcept { return lhs.distance > rhs.distance; }
+			};
+		};
+
+		static constexpr usize cell_count{ static_cast<usize>(ZoneSize.area()) };
+
+		static constexpr usize passable_words{ (cell_count + 63) / 64 };
+
+		// one zone per channel, so that each channel is contiguous in memory
+		std::array<zone_t<D>, Channels> distances;
+		std::array<sparse_t<D>, Channels> goals;
+
+		// scratch kept between calculations so that it is only allocated once
+		std::vector<u64> passable;
+		std::vector<mask_t> settled;
+		std::vector<front_t> seeds;
+		bucket_queue_t<D, DistanceFunction, wave_t> buckets;
+
+		static constexpr usize index(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(ZoneSize.w) + static_cast<usize>(position.x); }
+
+		static constexpr mask_t bit(usize channel) noexcept { return static_cast<mask_t>(mask_t{ 1 } << channel); }
+
+		constexpr bool is_passable(offset_t position) const noexcept {
+			const usize i{ index(position) };
+
+			return (passable[i / 64] >> (i % 64)) & 1;
+		}
+
+		// lowers every channel named by the mask whose distance at the position is final, then offers each passable neighbour to those channels at once
+		template<region_e Region, typename Push> constexpr void expand(offset_t position, D distance, mask_t channels, cref<Push> push) noexcept {
+			const usize i{ index(position) };
+
+			channels &= static_cast<mask_t>(~settled[i]);
+
+			for (mask_t remaining{ channels }; remaining != 0; remaining &= static_cast<mask_t>(remaining - 1)) {
+				const usize channel{ static_cast<usize>(std::countr_zero(remaining)) };
+
+				if (distances[channel][position] != distance) {
+					channels &= static_cast<mask_t>(~bit(channel));
+				}
+			}
+
+			if (channels == 0) {
+				return;
+			}
+
+			settled[i] |= channels;
+
+			for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+				const offset_t offset_position{ position + creeper.position };
+
+				if (!distances[0].dependent within<Region>(offset_position) || !is_passable(offset_position)) {
+					continue;
+				}
+
+				const D offset_distance{ static_cast<D>(distance + creeper.distance) };
+
+				mask_t improved{ 0 };
+
+				for (mask_t remaining{ channels }; remaining != 0; remaining &= static_cast<mask_t>(remaining - 1)) {
+					const usize channel{ static_cast<usize>(std::countr_zero(remaining)) };
+
+					ref<D> current{ distances[channel][offset_position] };
+
+					if (offset_distance >= current) {
+						continue;
+					}
+
+					current = offset_distance;
+					improved |= bit(channel);
+				}
+
+				if (improved != 0) {
+					push(wave_t{ offset_position, improved }, offset_distance);
+				}
+			}
+		}
+
+		template<region_e Region, typename T, typename U, typename Blocked> constexpr void propagate(cref<zone_t<T>> zone, cref<U> value, rval<Blocked> blocked) noexcept {
+			for (rauto channel : distances) {
+				channel.dependent set<Region>(obstacle_value);
+			}
+
+			passable.assign(passable_words, 0);
+
+			for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
+
+					if (zone.dependent within<Region>(position) && zone[position] == value && !blocked(position)) {
+						passable[index(position) / 64] |= u64{ 1 } << (index(position) % 64);
+					}
+				}
+			}
+
+			settled.assign(cell_count, 0);
+			seeds.clear();
+
+			mask_t negative{ 0 };
+
+			for (usize channel{ 0 }; channel < Channels; ++channel) {
+				for (crauto [g_pos, g_val] : goals[channel]) {
+					if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value || g_val >= distances[channel][g_pos]) {
+						continue;
+					}
+
+					distances[channel][g_pos] = g_val;
+
+					seeds.push_back(front_t{ g_val, g_pos, bit(channel) });
+
+					if (g_val < 0) {
+						negative |= bit(channel);
+					}
+				}
+			}
+
+			if (seeds.empty()) {
+				return;
+			}
+
+			if constexpr (std::is_integral<D>::value) {
+				buckets.drain(seeds, [](cref<front_t> seed) -> wave_t { return wave_t{ seed.position, seed.channels }; }, [&](cref<wave_t> wave, D level, crauto push) { expand<Region>(wave.position, level, wave.channels, push); });
+			} else {
+				std::priority_queue<front_t, std::vector<front_t>, typename front_t::greater> frontier{ typename front_t::greater{}, std::move(seeds) };
+
+				const auto push{ [&](cref<wave_t> wave, D distance) { frontier.push(front_t{ distance, wave.position, wave.channels }); } };
+
+				while (!frontier.empty()) {
+					const front_t current{ frontier.top() };
+					frontier.pop();
+
+					expand<Region>(current.position, current.distance, current.channels, push);
+				}
+
+				seeds.clear();
+			}
+
+			for (usize channel{ 0 }; channel < Channels; ++channel) {
+				if (negative & bit(channel)) {
+					homogenize(distances[channel]);
+				}
+			}
+		}
+
+	  public:
+		static constexpr usize channel_count{ Channels };
+
+		static constexpr D goal_value{ 0 };
+		static constexpr D obstacle_value{ ZoneSize.area() };
+
+		constexpr bool is_goal(D distance) const noexcept { return distance == goal_value; }
+
+		constexpr bool is_obstacle(D distance) const noexcept { return distance == obstacle_value; }
+
+		constexpr multi_field_t() noexcept : distances{}, goals{}, passable{}, settled{}, seeds{}, buckets{} { clear<region_e::All>(); }
+
+		template<region_e Region> constexpr ref<multi_field_t<D, Channels, DistanceFunction, ZoneSize, ZoneBorder, Layout>> clear() noexcept {
+			for (usize channel{ 0 }; channel < Channels; ++channel) {
+				clear<Region>(channel);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<multi_field_t<D, Channels, DistanceFunction, ZoneSize, ZoneBorder, Layout>> clear(usize channel) noexcept {
+			distances[channel].dependent set<Region>(obstacle_value);
+
+			if constexpr (Region == region_e::All) {
+				goals[channel].clear();
+			} else {
+				for (cauto [g_pos, _] : goals[channel]) {
+					if (distances[channel].dependent within<Region>(g_pos)) {
+						goals[channel].remove(g_pos);
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		constexpr cref<zone_t<D>> channel(usize channel) const noexcept { return distances[channel]; }
+
+		constexpr D operator[](usize channel, offset_t position) const noexcept {
+			if (!distances[channel].dependent within<region_e::All>(position)) {
+				return obstacle_value;
+			}
+
+			return distances[channel][position];
+		}
+
+		constexpr bool goal_reached(usize channel, offset_t position) const noexcept { return distances[channel][position] == goal_value; }
+
+		constexpr bool goal_reached(usize channel, offset_t position, D threshold) const noexcept { return distances[channel][position] <= threshold; }
+
+		template<region_e Region, typename T, SparseBlockage... Blockages> constexpr ref<multi_field_t<D, Channels, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<zone_t<T>> zone, cref<T> value, cref<Blockages>... blockages) noexcept {
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<multi_field_t<D, Channels, DistanceFunction, ZoneSize, ZoneBorder, Layout>> recalculate(cref<zone_t<T>> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr std::optional<offset_t> ascend(usize channel, offset_t position) const noexcept {
+			if (!distances[channel].dependent within<Region>(position)) {
+				return std::nullopt;
+			}
+
+			offset_t highest{ position };
+			D highest_distance{ goal_value };
+
+			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
+				const offset_t offset_position{ position + offset };
+
+				if (!distances[channel].dependent within<Region>(offset_position)) {
+					continue;
+				}
+
+				const D offset_distance{ distances[channel][offset_position] };
+
+				if (offset_distance == obstacle_value || offset_distance <= highest_distance) {
+					continue;
+				}
+
+				highest = offset_position;
+				highest_distance = offset_distance;
+			}
+
+			if (highest == position) {
+				return std::nullopt;
+			}
+
+			return highest;
+		}
+
+		template<region_e Region, SparseBlockage Blockage> constexpr std::optional<offset_t> ascend(usize channel, offset_t position, cref<Blockage> sparse_blockage) const noexcept {
+			if (!distances[channel].dependent within<Region>(position)) {
+				return std::nullopt;
+			}
+
+			offset_t highest{ position };
+			D highest_distance{ goal_value };
+
+			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
+				const offset_t offset_position{ position + offset };
+
+				if (!distances[channel].dependent within<Region>(offset_position) || sparse_blockage.contains(offset_position)) {
+					continue;
+				}
+
+				const D offset_distance{ distances[channel][offset_position] };
+
+				if (offset_distance == obstacle_value || offset_distance <= highest_distance) {
+					continue;
+				}
+
+				highest = offset_position;
+				highest_distance = offset_distance;
+			}
+
+			if (highest == position) {
+				return std::nullopt;
+			}
+
+			return highest;
+		}
+
+		template<region_e Region> constexpr std::optional<offset_t> descend(usize channel, offset_t position) const noexcept {
+			if (!distances[channel].dependent within<Region>(position) || goal_reached(channel, position)) {
+				return std::nullopt;
+			}
+
+			offset_t lowest{ position };
+			D lowest_distance{ obstacle_value };
+
+			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
+				const offset_t offset_position{ position + offset };
+
+				if (!distances[channel].dependent within<Region>(offset_position)) {
+					continue;
+				}
+
+				const D offset_distance{ distances[channel][offset_position] };
+
+				if (offset_distance >= lowest_distance) {
+					continue;
+				}
+
+				lowest = offset_position;
+				lowest_distance = offset_distance;
+			}
+
+			if (lowest == position) {
+				return std::nullopt;
+			}
+
+			return lowest;
+		}
+
+		template<region_e Region, SparseBlockage Blockage> constexpr std::optional<offset_t> descend(usize channel, offset_t position, cref<Blockage> sparse_blockage) const noexcept {
+			if (!distances[channel].dependent within<Region>(position) || goal_reached(channel, position)) {
+				return std::nullopt;
+			}
+
+			offset_t lowest{ position };
+			D lowest_distance{ obstacle_value };
+
+			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
+				const offset_t offset_position{ position + offset };
+
+				if (!distances[channel].dependent within<Region>(offset_position) || sparse_blockage.contains(offset_position)) {
+					continue;
+				}
+
+				const D offset_distance{ distances[channel][offset_position] };
+
+				if (offset_distance >= lowest_distance) {
+					continue;
+				}
+
+				lowest = offset_position;
+				lowest_distance = offset_distance;
+			}
+
+			if (lowest == position) {
+				return std::nullopt;
+			}
+
+			return lowest;
+		}
+
+		template<region_e Region> constexpr bool add(usize channel, offset_t goal) noexcept {
+			if (!distances[channel].dependent within<Region>(goal)) {
+				return false;
+			}
+
+			return goals[channel].add(goal, goal_value);
+		}
+
+		constexpr bool add(usize channel, offset_t goal) noexcept { return add<region_e::All>(channel, goal); }
+
+		template<region_e Region> constexpr bool add(usize channel, offset_t goal, D value) noexcept {
+			if (!distances[channel].dependent within<Region>(goal) || value > goal_value) {
+				return false;
+			}
+
+			return goals[channel].add(goal, value);
+		}
+
+		constexpr bool add(usize channel, offset_t goal, D value) noexcept { return add<region_e::All>(channel, goal, value); }
+
+		template<region_e Region> constexpr bool remove(usize channel, offset_t goal) noexcept {
+			if (!distances[channel].dependent within<Region>(goal)) {
+				return false;
+			}
+
+			return goals[channel].remove(goal);
+		}
+
+		constexpr bool remove(usize channel, offset_t goal) noexcept { return remove<region_e::All>(channel, goal); }
+
+		template<region_e Region> constexpr bool update(usize channel, offset_t from, offset_t to) noexcept {
+			if (!distances[channel].dependent within<Region>(from) || !distances[channel].dependent within<Region>(to)) {
+				return false;
+			}
+
+			return goals[channel].update(from, to);
+		}
+
+		constexpr bool update(usize channel, offset_t from, offset_t to) noexcept { return update<region_e::All>(channel, from, to); }
+	};
+} // namespace bleak
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <bleak/array.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// an array surrounded by a ghost ring of halo cells; offsets are relative to the first unpadded cell and may extend up to the halo beyond either edge
+	// the cells are held in the container of the storage policy, so scratch copies of heap-backed zones are themselves heap-backed
+	template<typename T, extent_t Size, extent_t Halo = extent_t{ 1, 1 }, typename Storage = row_major_layout_t> struct padded_array_t {
+	  public:
+		static constexpr extent_t size{ Size };
+		static constexpr extent_t halo{ Halo };
+
+		static constexpr extent_t padded_size{ Size + Halo * 2 };
+
+		static constexpr usize area{ padded_size.size() };
+
+		static constexpr usize byte_size{ area * sizeof(T) };
+
+		static_assert(Size.size() > 0, "padded array size must have a size greater than zero!");
+		static_assert(byte_size <= memory::Maximum, "padded array size must not exceed the maximum!");
+
+		static constexpr usize stride{ static_cast<usize>(padded_size.w) };
+
+		static inline constexpr usize flatten(offset_t offset) noexcept { return static_cast<usize>(offset.y + Halo.h) * stride + static_cast<usize>(offset.x + Halo.w); }
+
+		static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return static_cast<usize>(j + Halo.h) * stride + static_cast<usize>(i + Halo.w); }
+
+	  private:
+		typename Storage::template container_t<T, area> data;
+
+	  public:
+		inline constexpr padded_array_t() noexcept : data{} {}
+
+		inline constexpr padded_array_t(cref<T> sentinel) noexcept : data{} { data.fill(sentinel); }
+
+		template<typename Layout> inline constexpr padded_array_t(cref<array_t<T, Size, Layout>> source, cref<T> sentinel) noexcept : data{} {
+			fill_halo(sentinel);
+			assign(source);
+		}
+
+		inline constexpr padded_array_t(cref<padded_array_t> other) noexcept : data{ other.data } {}
+
+		inline constexpr padded_array_t(rval<padded_array_t> other) noexcept : data{ std::move(other.data) } {}
+
+		inline constexpr ref<padded_array_t> operator=(cref<padded_array_t> other) noexcept {
+			if (this != &other) {
+				data = other.data;
+			}
+
+			return *this;
+		}
+
+		inline constexpr ref<padded_array_t> operator=(rval<padded_array_t> other) noexcept {
+			if (this != &other) {
+				data = std::move(other.data);
+			}
+
+			return *this;
+		}
+
+		inline constexpr ~padded_array_t() noexcept {}
+
+		inline constexpr ref<T> operator[](offset_t offset) noexcept { return data[flatten(offset)]; }
+
+		inline constexpr cref<T> operator[](offset_t offset) const noexcept { return data[flatten(offset)]; }
+
+		inline constexpr ref<T> operator[](offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return data[flatten(i, j)]; }
+
+		inline constexpr cref<T> operator[](offset_t::scalar_t i, offset_t::scalar_t j) const noexcept { return data[flatten(i, j)]; }
+
+		inline constexpr ptr<T> data_ptr() noexcept { return data.data(); }
+
+		inline constexpr cptr<T> data_ptr() const noexcept { return data.data(); }
+
+		inline constexpr void fill(cref<T> value) noexcept { data.fill(value); }
+
+		// overwrites every cell of the ghost ring while leaving the unpadded cells untouched
+		inline constexpr void fill_halo(cref<T> sentinel) noexcept {
+			for (usize y{ 0 }; y < static_cast<usize>(padded_size.h); ++y) {
+				if (y < static_cast<usize>(Halo.h) || y >= static_cast<usize>(Halo.h + Size.h)) {
+					std::fill_n(data.begin() + y * stride, stride, sentinel);
+				} else {
+					std::fill_n(data.begin() + y * stride, static_cast<usize>(Halo.w), sentinel);
+					std::fill_n(data.begin() + y * stride + static_cast<usize>(Halo.w + Size.w), static_cast<usize>(Halo.w), sentinel);
+				}
+			}
+		}
+
+		template<typename Layout> inline constexpr void assign(cref<array_t<T, Size, Layout>> source) noexcept {
+			for (offset_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				if constexpr (Layout::contiguous_rows) {
+					std::copy_n(&source[0, y], static_cast<usize>(Size.w), data.begin() + flatten(0, y));
+				} else {
+					for (offset_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+						data[flatten(x, y)] = source[x, y];
+					}
+				}
+			}
+		}
+
+		template<typename Layout> inline constexpr void extract(ref<array_t<T, Size, Layout>> target) const noexcept {
+			for (offset_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				if constexpr (Layout::contiguous_rows) {
+					std::copy_n(data.begin() + flatten(0, y), static_cast<usize>(Size.w), &target[0, y]);
+				} else {
+					for (offset_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+						target[x, y] = data[flatten(x, y)];
+					}
+				}
+			}
+		}
+
+		// moore neighbourhood count without bounds checks; the halo stands in for every off-edge neighbour
+		template<typename U> inline constexpr u8 neighbour_count(offset_t position, cref<U> value) const noexcept {
+			static_assert(Halo.w > 0 && Halo.h > 0, "neighbour count requires a halo of at least one cell!");
+
+			cptr<T> north{ data.data() + flatten(position) - stride };
+			cptr<T> row{ north + stride };
+			cptr<T> south{ row + stride };
+
+			return static_cast<u8>(
+				(north[-1] == value) + (north[0] == value) + (north[1] == value) +
+				(row[-1] == value) + (row[1] == value) +
+				(south[-1] == value) + (south[0] == value) + (south[1] == value)
+			);
+		}
+
+		// equivalent of the melded solver index without bounds checks
+		template<typename U> inline constexpr u8 melded_index(offset_t position, cref<U> value) const noexcept {
+			static_assert(Halo.w > 0 && Halo.h > 0, "melded index requires a halo of at least one cell!");
+
+			cptr<T> north{ data.data() + flatten(position) - stride };
+			cptr<T> row{ north + stride };
+			cptr<T> south{ row + stride };
+
+			const bool nw{ north[-1] == value };
+			const bool n{ north[0] == value };
+			const bool ne{ north[1] == value };
+
+			const bool w{ row[-1] == value };
+			const bool e{ row[1] == value };
+
+			const bool sw{ south[-1] == value };
+			const bool s{ south[0] == value };
+			const bool se{ south[1] == value };
+
+			return static_cast<u8>(((nw && n && w) << 3) | ((n && ne && e) << 2) | ((e && se && s) << 1) | ((w && sw && s) << 0));
+		}
+	};
+} // namespace bleak
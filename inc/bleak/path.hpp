@@ -27,8 +27,9 @@ namespace bleak {
 		using sparse_t = std::unordered_set<offset_t, offset_t::std_hasher>;
 		using trail_t = std::unordered_map<offset_t, rememberance_t<offset_t>, offset_t::std_hasher>;
 
-		#define dense_t zone_t<T, Size, BorderSize>
-		#define dense_args typename T, extent_t Size, extent_t BorderSize
+		// zones and views over regions of zones alike are searched through their cells and bounds alone
+		#define dense_t Zone
+		#define dense_args ZoneLike Zone
 
 		inline path_t() noexcept : points{} {}
 
@@ -76,7 +77,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args>
-		inline ref<path_t> generate(cref<line_t> line, cref<dense_t> zone, cref<T> value) {
+		inline ref<path_t> generate(cref<line_t> line, cref<dense_t> zone, cref<typename Zone::value_type> value) {
 			if (!empty()) {
 				clear();
 			}
@@ -125,7 +126,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline ref<path_t> generate(cref<line_t> line, cref<dense_t> zone, cref<U> value) {
 			if (!empty()) {
 				clear();
@@ -175,7 +176,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, bool Inclusive = false, dense_args>
-		inline ref<path_t> generate(cref<line_t> line, cref<dense_t> zone, cref<T> value, cref<sparse_t> sparse_blockage) {
+		inline ref<path_t> generate(cref<line_t> line, cref<dense_t> zone, cref<typename Zone::value_type> value, cref<sparse_t> sparse_blockage) {
 			if (!empty()) {
 				clear();
 			}
@@ -230,7 +231,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, bool Inclusive = false, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline ref<path_t> generate(cref<line_t> line, cref<dense_t> zone, cref<U> value, cref<sparse_t> sparse_blockage) {
 			if (!empty()) {
 				clear();
@@ -286,7 +287,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, distance_function_e Distance, dense_args>
-		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value) {
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<typename Zone::value_type> value) {
 			if (!empty()) {
 				clear();
 			}
@@ -335,7 +336,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, distance_function_e Distance, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value) {
 			if (!empty()) {
 				clear();
@@ -385,7 +386,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, distance_function_e Distance, bool Inclusive = false, dense_args>
-		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value, cref<sparse_t> sparse_blockage) {
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<typename Zone::value_type> value, cref<sparse_t> sparse_blockage) {
 			if (!empty()) {
 				clear();
 			}
@@ -440,7 +441,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, distance_function_e Distance, bool Inclusive = false, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value, cref<sparse_t> sparse_blockage) {
 			if (!empty()) {
 				clear();
@@ -552,7 +553,7 @@ namespace bleak {
 		std::stack<offset_t> points;
 
 		template<region_e Region, dense_args>
-		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value) const {
+		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<typename Zone::value_type> value) const {
 			if (!zone.dependent within<Region>(origin) || !zone.dependent within<Region>(destination)) {
 				return false;
 			}
@@ -564,8 +565,8 @@ namespace bleak {
 			return true;
 		}
 
-		template<region_e Region, typename T, typename U, extent_t Size, extent_t BorderSize>
-			requires is_equatable<T, U>::value
+		template<region_e Region, dense_args, typename U>
+			requires is_zone_comparable<Zone, U>::value
 		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value) const {
 			if (!zone.dependent within<Region>(origin) || !zone.dependent within<Region>(destination)) {
 				return false;
@@ -579,7 +580,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args>
-		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value, cref<sparse_t> blockage) const {
+		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<typename Zone::value_type> value, cref<sparse_t> blockage) const {
 			if (!zone.dependent within<Region>(origin) || !zone.dependent within<Region>(destination)) {
 				return false;
 			}
@@ -595,8 +596,8 @@ namespace bleak {
 			return true;
 		}
 
-		template<region_e Region, typename T, typename U, extent_t Size, extent_t BorderSize>
-			requires is_equatable<T, U>::value
+		template<region_e Region, dense_args, typename U>
+			requires is_zone_comparable<Zone, U>::value
 		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value, cref<sparse_t> blockage) const {
 			if (!zone.dependent within<Region>(origin) || !zone.dependent within<Region>(destination)) {
 				return false;
@@ -614,7 +615,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args>
-		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<T> value) const {
+		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<typename Zone::value_type> value) const {
 			if (!zone.dependent within<Region>(position)) {
 				return false;
 			}
@@ -627,7 +628,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<U> value) const {
 			if (!zone.dependent within<Region>(position)) {
 				return false;
@@ -641,7 +642,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args>
-		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<T> value, cref<sparse_t> visited) const {
+		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<typename Zone::value_type> value, cref<sparse_t> visited) const {
 			if (!zone.dependent within<Region>(position)) {
 				return false;
 			}
@@ -658,7 +659,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<U> value, cref<sparse_t> visited) const {
 			if (!zone.dependent within<Region>(position)) {
 				return false;
@@ -676,7 +677,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args>
-		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<T> value, cref<sparse_t> visited, cref<sparse_t> blockage) const {
+		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<typename Zone::value_type> value, cref<sparse_t> visited, cref<sparse_t> blockage) const {
 			if (!zone.dependent within<Region>(position)) {
 				return false;
 			}
@@ -697,7 +698,7 @@ namespace bleak {
 		}
 
 		template<region_e Region, dense_args, typename U>
-			requires is_equatable<T, U>::value
+			requires is_zone_comparable<Zone, U>::value
 		inline bool is_valid(offset_t position, cref<dense_t> zone, cref<U> value, cref<sparse_t> visited, cref<sparse_t> blockage) const {
 			if (!zone.dependent within<Region>(position)) {
 				return false;
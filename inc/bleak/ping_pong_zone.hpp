@@ -0,0 +1,173 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <utility>
+
+#include <bleak/applicator.hpp>
+#include <bleak/array.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// a zone paired with a persistent back buffer; each pass reads the front, writes its region into the back and flips, so no pass begins with a full copy.
+	// tied cells of automatize keep the value of the back, which is the generation before the front, so that a run of passes settles exactly as zone_t::automatize does with a buffer that starts as a copy of the cells
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero, typename Layout = row_major_layout_t> struct ping_pong_zone_t {
+	  public:
+		using zone_type = zone_t<T, Size, BorderSize, Layout>;
+
+	  private:
+		zone_type first;
+		zone_type second;
+
+		bool flipped;
+
+		// the region in which the back buffer may differ from the front
+		region_e stale;
+
+		// whether the back holds no earlier generation of the front at all, as after modify
+		bool detached;
+
+		constexpr ref<zone_type> front_zone() noexcept { return flipped ? second : first; }
+
+		constexpr ref<zone_type> back_zone() noexcept { return flipped ? first : second; }
+
+		// brings the back buffer up to date outside of the region that the next pass is about to write
+		template<region_e Region, execution_e Execution> inline void prepare() noexcept {
+			if (stale == region_e::None || stale == Region) {
+				return;
+			}
+
+			if constexpr (Region == region_e::Interior) {
+				front_zone().template copy_into<region_e::Border, Execution>(back_zone());
+			} else if constexpr (Region == region_e::Border) {
+				front_zone().template copy_into<region_e::Interior, Execution>(back_zone());
+			}
+		}
+
+		// a detached back is brought up to date so that the ties of the next automatize keep the current cells
+		template<execution_e Execution> inline void renew() noexcept {
+			if (!detached) {
+				return;
+			}
+
+			front_zone().template copy_into<region_e::All, Execution>(back_zone());
+			stale = region_e::None;
+			detached = false;
+		}
+
+		template<region_e Region> constexpr void flip() noexcept {
+			flipped = !flipped;
+			stale = Region;
+		}
+
+	  public:
+		constexpr ping_pong_zone_t() noexcept : first{}, second{}, flipped{ false }, stale{ region_e::None }, detached{ false } {}
+
+		constexpr explicit ping_pong_zone_t(cref<zone_type> other) noexcept : first{ other }, second{ other }, flipped{ false }, stale{ region_e::None }, detached{ false } {}
+
+		constexpr explicit ping_pong_zone_t(rval<zone_type> other) noexcept : first{ std::move(other) }, second{ first }, flipped{ false }, stale{ region_e::None }, detached{ false } {}
+
+		constexpr ping_pong_zone_t(cref<ping_pong_zone_t> other) noexcept : first{ other.first }, second{ other.second }, flipped{ other.flipped }, stale{ other.stale }, detached{ other.detached } {}
+
+		constexpr ping_pong_zone_t(rval<ping_pong_zone_t> other) noexcept : first{ std::move(other.first) }, second{ std::move(other.second) }, flipped{ other.flipped }, stale{ other.stale }, detached{ other.detached } {}
+
+		constexpr ref<ping_pong_zone_t> operator=(cref<ping_pong_zone_t> other) noexcept {
+			if (this != &other) {
+				first = other.first;
+				second = other.second;
+				flipped = other.flipped;
+				stale = other.stale;
+				detached = other.detached;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<ping_pong_zone_t> operator=(rval<ping_pong_zone_t> other) noexcept {
+			if (this != &other) {
+				first = std::move(other.first);
+				second = std::move(other.second);
+				flipped = other.flipped;
+				stale = other.stale;
+				detached = other.detached;
+			}
+
+			return *this;
+		}
+
+		constexpr ~ping_pong_zone_t() noexcept {}
+
+		constexpr cref<zone_type> front() const noexcept { return flipped ? second : first; }
+
+		constexpr cref<zone_type> get() const noexcept { return front(); }
+
+		constexpr operator cref<zone_type>() const noexcept { return front(); }
+
+		constexpr cref<T> operator[](offset_t position) const noexcept { return front()[position]; }
+
+		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return front()[x, y]; }
+
+		// runs an arbitrary operation directly against the front, after which the back is considered stale everywhere
+		template<typename Mutator> constexpr ref<ping_pong_zone_t> modify(rval<Mutator> mutator) noexcept {
+			mutator(front_zone());
+			stale = region_e::All;
+			detached = true;
+
+			return *this;
+		}
+
+		// runs a custom pass; the callback receives the front and the back and writes the region into the back, where any cell it leaves alone keeps the generation before the front
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename Pass> inline ref<ping_pong_zone_t> pass(rval<Pass> callback) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			prepare<Region, Execution>();
+			callback(std::as_const(front_zone()), back_zone());
+			flip<Region>();
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<ping_pong_zone_t> automatize(u8 threshold, cref<U> true_state, cref<U> false_state) noexcept {
+			renew<Execution>();
+
+			return pass<Region, Execution>([&](cref<zone_type> front, ref<zone_type> back) { front.template automatize_into<Region, Execution>(back, threshold, true_state, false_state); });
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<ping_pong_zone_t> automatize(u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize<Region, Execution>(threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<ping_pong_zone_t> automatize(u32 iterations, u8 threshold, cref<U> true_state, cref<U> false_state) noexcept {
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize<Region, Execution>(threshold, true_state, false_state);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<ping_pong_zone_t> automatize(u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize<Region, Execution>(iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<ping_pong_zone_t> collapse(cref<U> value, usize index, cref<U> collapse_to) noexcept {
+			return pass<Region, Execution>([&](cref<zone_type> front, ref<zone_type> back) { front.template collapse_into<Region, Execution>(back, value, index, collapse_to); });
+		}
+	};
+} // namespace bleak
@@ -5,6 +5,90 @@
 #include <random> // IWYU pragma: export
 
 namespace bleak {
+	// counter-based generator after widynski's squares; any output follows directly from the key and its position in the stream, so streams can be indexed and split without replaying them
+	struct squares_t {
+		using result_type = u64;
+
+		static constexpr u64 default_seed{ 0x9E37'79B9'7F4A'7C15 };
+
+		static constexpr result_type min() noexcept { return 0; }
+
+		static constexpr result_type max() noexcept { return ~result_type{ 0 }; }
+
+		// keys should be dense in set bits, so the seed is scrambled and forced odd
+		static constexpr u64 derive_key(u64 seed) noexcept {
+			u64 z{ seed + default_seed };
+
+			z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9;
+			z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EB;
+
+			return (z ^ (z >> 31)) | 1;
+		}
+
+		static constexpr result_type generate(u64 key, u64 counter) noexcept {
+			u64 x{ counter * key };
+
+			const u64 y{ x };
+			const u64 z{ y + key };
+
+			x = x * x + y;
+			x = (x >> 32) | (x << 32);
+
+			x = x * x + z;
+			x = (x >> 32) | (x << 32);
+
+			x = x * x + y;
+			x = (x >> 32) | (x << 32);
+
+			const u64 t{ x * x + z };
+
+			x = (t >> 32) | (t << 32);
+
+			return t ^ ((x * x + y) >> 32);
+		}
+
+		// the integer threshold below which the top fifty-three bits of an output occur with the given probability
+		static constexpr u64 threshold(f64 probability) noexcept {
+			if (probability <= 0.0) {
+				return 0;
+			} else if (probability >= 1.0) {
+				return u64{ 1 } << 53;
+			}
+
+			return static_cast<u64>(probability * 0x1.0p53);
+		}
+
+		static constexpr bool below(result_type value, u64 threshold) noexcept { return (value >> 11) < threshold; }
+
+	  private:
+		u64 key;
+		u64 counter;
+
+	  public:
+		constexpr squares_t() noexcept : key{ derive_key(default_seed) }, counter{ 0 } {}
+
+		constexpr explicit squares_t(u64 seed) noexcept : key{ derive_key(seed) }, counter{ 0 } {}
+
+		constexpr void seed(u64 value) noexcept {
+			key = derive_key(value);
+			counter = 0;
+		}
+
+		constexpr result_type operator()() noexcept { return generate(key, counter++); }
+
+		constexpr void discard(u64 count) noexcept { counter += count; }
+
+		// the output at an arbitrary position of the stream without advancing it
+		constexpr result_type at(u64 position) const noexcept { return generate(key, position); }
+
+		// the output for a pair of coordinates, such as those of a cell
+		constexpr result_type at(u32 x, u32 y) const noexcept { return generate(key, (static_cast<u64>(y) << 32) | x); }
+
+		constexpr bool operator==(cref<squares_t> other) const noexcept { return key == other.key && counter == other.counter; }
+
+		constexpr bool operator!=(cref<squares_t> other) const noexcept { return key != other.key || counter != other.counter; }
+	};
+
 	template<typename T> struct is_random_engine {
 		static const bool value = false;
 	};
@@ -41,10 +125,27 @@ namespace bleak {
 		static const bool value = true;
 	};
 
+	template<> struct is_random_engine<squares_t> {
+		static const bool value = true;
+	};
+
 	template<typename T> constexpr bool is_random_engine_v = is_random_engine<T>::value;
 
 	template<typename T> concept RandomEngine = is_random_engine<T>::value;
 
+	// engines whose outputs may be computed directly from a position rather than drawn in sequence
+	template<typename T> struct is_counter_based_engine {
+		static const bool value = false;
+	};
+
+	template<> struct is_counter_based_engine<squares_t> {
+		static const bool value = true;
+	};
+
+	template<typename T> constexpr bool is_counter_based_engine_v = is_counter_based_engine<T>::value;
+
+	template<typename T> concept CounterBasedEngine = RandomEngine<T> && is_counter_based_engine<T>::value;
+
 	template<typename T> struct is_random_distribution {
 		static const bool value = false;
 	};
@@ -2,28 +2,175 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
+#include <bleak/applicator.hpp>
+#include <bleak/archive.hpp>
 #include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
 #include <bleak/log.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/padded_array.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/stencil.hpp>
+#include <bleak/thread_pool.hpp>
 #include <bleak/zone.hpp>
 
+#include <bleak/constants/enums.hpp>
+
 namespace bleak {
 	struct region_offset_t {
 		offset_t zone;
 		offset_t cell;
 	};
 
-	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder> struct region_t {
+	// a read-only view of a region in global coordinates; each lookup divides the position by the zone size to find its zone and cell, so nothing is copied. bounded exactly as the compiled zone would be
+	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder, typename Layout> struct region_view_t {
+	  public:
+		using value_type = T;
+
+		using zone_type = zone_t<T, ZoneSize, ZoneBorder>;
+		using zones_type = array_t<zone_type, RegionSize, Layout>;
+
+		static constexpr extent_t region_size{ RegionSize };
+
+		// the view is sized and bounded as the one zone spanning the region, so that fields, areas and paths run on it as they do on a zone
+		static constexpr extent_t zone_size{ region_size * ZoneSize };
+		static constexpr extent_t border_size{ ZoneBorder };
+
+		static constexpr offset_t zone_origin{ 0 };
+		static constexpr offset_t zone_extent{ zone_size - 1 };
+
+		static constexpr offset_t interior_origin{ border_size.w, border_size.h };
+		static constexpr offset_t interior_extent{ zone_size.w - border_size.w, zone_size.h - border_size.h };
+
+		static constexpr auto zone_area{ zone_size.area() };
+
 	  private:
-		array_t<zone_t<T, ZoneSize, ZoneBorder>, RegionSize> zones;
+		cptr<zones_type> zones;
+
+	  public:
+		constexpr explicit region_view_t(cref<zones_type> zones) noexcept : zones{ &zones } {}
+
+		// the zone holding a global position and the position within it; positions are never negative, so the division is a shift for power of two zone sizes
+		static constexpr region_offset_t locate(offset_t position) noexcept {
+			const offset_t zone{ static_cast<u32>(position.x) / static_cast<u32>(zone_type::zone_size.w), static_cast<u32>(position.y) / static_cast<u32>(zone_type::zone_size.h) };
+
+			return region_offset_t{ zone, position - zone * zone_type::zone_size };
+		}
+
+		constexpr cref<zone_type> zone(offset_t position) const noexcept { return (*zones)[locate(position).zone]; }
+
+		constexpr cref<T> operator[](offset_t position) const noexcept {
+			const region_offset_t location{ locate(position) };
+
+			return (*zones)[location.zone][location.cell];
+		}
+
+		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return (*this)[offset_t{ x, y }]; }
+
+		template<region_e Region> constexpr bool within(offset_t position) const noexcept {
+			if constexpr (Region == region_e::All) {
+				return position.x >= zone_origin.x && position.x <= zone_extent.x && position.y >= zone_origin.y && position.y <= zone_extent.y;
+			} else if constexpr (Region == region_e::Interior) {
+				return position.x >= interior_origin.x && position.x <= interior_extent.x && position.y >= interior_origin.y && position.y <= interior_extent.y;
+			} else if constexpr (Region == region_e::Border) {
+				return within<region_e::All>(position) && !within<region_e::Interior>(position);
+			}
+
+			return false;
+		}
+
+		template<region_e Region, typename U>
+			requires is_equatable<T, U>::value
+		constexpr u32 count(cref<U> value) const noexcept {
+			u32 total{ 0 };
+
+			for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+				for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
+					if (within<Region>(offset_t{ x, y }) && (*this)[x, y] == value) {
+						++total;
+					}
+				}
+			}
+
+			return total;
+		}
+
+		// off-edge neighbours count as matching, as they do for a zone
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr u8 neighbour_count(offset_t position, cref<U> value) const noexcept {
+			u8 count{ 0 };
+
+			for (crauto direction : { offset_t::Northwest, offset_t::North, offset_t::Northeast, offset_t::West, offset_t::East, offset_t::Southwest, offset_t::South, offset_t::Southeast }) {
+				const offset_t neighbour{ position + direction };
+
+				if (!within<region_e::All>(neighbour) || (*this)[neighbour] == value) {
+					++count;
+				}
+			}
+
+			return count;
+		}
+
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr bool linear_blockage(offset_t origin, offset_t target, cref<U> value) const noexcept {
+			if ((*this)[origin] == value || (*this)[target] == value) {
+				return true;
+			}
+
+			if (origin == target) {
+				return false;
+			}
+
+			offset_t delta{ std::abs(target.x - origin.x), std::abs(target.y - origin.y) };
+
+			offset_t step{ origin.x < target.x ? 1 : -1, origin.y < target.y ? 1 : -1 };
+
+			i32 err = delta.x - delta.y;
+
+			offset_t current_position{ origin };
+
+			for (;;) {
+				if (current_position == target) {
+					return false;
+				}
+
+				if ((*this)[current_position] == value) {
+					return true;
+				}
+
+				i32 e2 = 2 * err;
+
+				if (e2 > -delta.y) {
+					err -= delta.y;
+					current_position.x += step.x;
+				}
+
+				if (e2 < delta.x) {
+					err += delta.x;
+					current_position.y += step.y;
+				}
+			}
+		}
+	};
+
+	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder, typename Layout> struct region_t {
+	  private:
+		array_t<zone_t<T, ZoneSize, ZoneBorder>, RegionSize, Layout> zones;
 
 	  public:
 		using zone_type = zone_t<T, ZoneSize, ZoneBorder>;
 
+		using view_type = region_view_t<T, RegionSize, ZoneSize, ZoneBorder, Layout>;
+
 		static constexpr extent_t region_size{ RegionSize };
 
 		static constexpr offset_t region_origin{ 0 };
@@ -95,6 +242,8 @@ namespace bleak {
 
 		constexpr ~region_t() noexcept {};
 
+		constexpr region_t clone() const noexcept { return region_t{ *this }; }
+
 		constexpr ref<zone_t<T, ZoneSize, ZoneBorder>> operator[](offset_t::product_t position) noexcept { return zones[position]; }
 
 		constexpr cref<zone_t<T, ZoneSize, ZoneBorder>> operator[](offset_t::product_t position) const noexcept { return zones[position]; }
@@ -115,38 +264,198 @@ namespace bleak {
 
 		constexpr cref<T> operator[](cref<region_offset_t> position) const noexcept { return zones[position.zone][position.cell]; }
 
-		constexpr zone_t<T, RegionSize * ZoneSize, ZoneBorder> compile() const noexcept {
-			zone_t<T, RegionSize * ZoneSize, ZoneBorder> zone{};
+		constexpr zone_t<T, RegionSize * ZoneSize, ZoneBorder, Layout> compile() const noexcept {
+			zone_t<T, RegionSize * ZoneSize, ZoneBorder, Layout> zone{};
+
+			compile(zone);
+
+			return zone;
+		}
 
+		constexpr void compile(ref<zone_t<T, RegionSize * ZoneSize, ZoneBorder, Layout>> zone) const noexcept {
 			for (extent_t::scalar_t region_y{ 0 }; region_y < region_size.h; ++region_y) {
 				for (extent_t::scalar_t region_x{ 0 }; region_x < region_size.w; ++region_x) {
 					const offset_t region_pos{ region_x, region_y };
+
+					cref<zone_type> source{ zones[region_pos] };
+
 					for (extent_t::scalar_t zone_y{ 0 }; zone_y < zone_size.h; ++zone_y) {
-						for (extent_t::scalar_t zone_x{ 0 }; zone_x < zone_size.w; ++zone_x) {
-							const offset_t zone_pos{ zone_x, zone_y };
-							zone[region_pos * zone_size + zone_pos] = zones[region_pos][zone_pos];
+						if constexpr (Layout::contiguous_rows) {
+							std::copy_n(&source[offset_t{ 0, zone_y }], zone_size.w, &zone[region_pos * zone_size + offset_t{ 0, zone_y }]);
+						} else {
+							for (extent_t::scalar_t zone_x{ 0 }; zone_x < zone_size.w; ++zone_x) {
+								const offset_t zone_pos{ zone_x, zone_y };
+								zone[region_pos * zone_size + zone_pos] = source[zone_pos];
+							}
 						}
 					}
 				}
 			}
+		}
 
-			return zone;
+		// the region in global coordinates without copying; valid for as long as the region lives
+		constexpr view_type view() const noexcept { return view_type{ zones }; }
+
+	  private:
+		// whether the global position falls within the region of the compiled zone, whose interior is bounded exactly as zone_t bounds it
+		template<region_e Region> static constexpr bool covers(offset_t position) noexcept {
+			constexpr offset_t interior_origin{ ZoneBorder.w, ZoneBorder.h };
+			constexpr offset_t interior_extent{ size.w - ZoneBorder.w, size.h - ZoneBorder.h };
+
+			if constexpr (Region == region_e::All) {
+				return true;
+			} else if constexpr (Region == region_e::Interior) {
+				return position.x >= interior_origin.x && position.x <= interior_extent.x && position.y >= interior_origin.y && position.y <= interior_extent.y;
+			} else if constexpr (Region == region_e::Border) {
+				return position.x < interior_origin.x || position.x > interior_extent.x || position.y < interior_origin.y || position.y > interior_extent.y;
+			}
+
+			return false;
 		}
 
-		constexpr void compile(ref<zone_t<T, RegionSize * ZoneSize, ZoneBorder>> zone) const noexcept {
-			for (extent_t::scalar_t region_y{ 0 }; region_y < region_size.h; ++region_y) {
-				for (extent_t::scalar_t region_x{ 0 }; region_x < region_size.w; ++region_x) {
-					const offset_t region_pos{ region_x, region_y };
-					for (extent_t::scalar_t zone_y{ 0 }; zone_y < zone_size.h; ++zone_y) {
-						for (extent_t::scalar_t zone_x{ 0 }; zone_x < zone_size.w; ++zone_x) {
-							const offset_t zone_pos{ zone_x, zone_y };
-							zone[region_pos * zone_size + zone_pos] = zones[region_pos][zone_pos];
-						}
+		// copies the zone and a one cell halo taken from the edges of its neighbours; beyond the edge of the region the halo holds the edge value
+		inline void exchange(offset_t region_pos, ref<padded_array_t<T, ZoneSize>> padded, cref<T> edge) const noexcept {
+			padded.assign(zones[region_pos].data());
+
+			const auto fetch{ [&](offset_t local) -> T {
+				const offset_t step{ extent_t::scalar_cast(local.x < 0 ? -1 : local.x >= zone_size.w ? 1 : 0), extent_t::scalar_cast(local.y < 0 ? -1 : local.y >= zone_size.h ? 1 : 0) };
+				const offset_t neighbour{ region_pos + step };
+
+				if (neighbour.x < 0 || neighbour.y < 0 || neighbour.x >= region_size.w || neighbour.y >= region_size.h) {
+					return edge;
+				}
+
+				return zones[neighbour][local - step * zone_size];
+			} };
+
+			for (extent_t::scalar_t x{ -1 }; x <= zone_size.w; ++x) {
+				padded[x, -1] = fetch(offset_t{ x, -1 });
+				padded[x, zone_size.h] = fetch(offset_t{ x, zone_size.h });
+			}
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				padded[-1, y] = fetch(offset_t{ -1, y });
+				padded[zone_size.w, y] = fetch(offset_t{ zone_size.w, y });
+			}
+		}
+
+		// tied cells take their value from the previous generation, which is only read within the zone and so needs no halo of its own
+		template<region_e Region, typename Stage> inline void step(offset_t region_pos, cref<padded_array_t<T, ZoneSize>> padded, cref<padded_array_t<T, ZoneSize>> previous, cref<Stage> stage) noexcept {
+			ref<zone_type> zone{ zones[region_pos] };
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				cptr<T> north{ &padded[0, y - 1] };
+				cptr<T> row{ &padded[0, y] };
+				cptr<T> south{ &padded[0, y + 1] };
+
+				cptr<T> former{ &previous[0, y] };
+
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					if (!covers<Region>(region_pos * zone_size + offset_t{ x, y })) {
+						continue;
+					}
+
+					zone[x, y] = static_cast<T>(stage(north + x, row + x, south + x, former[x]));
+				}
+			}
+		}
+
+		template<execution_e Execution, typename Task> static inline void each_zone(rval<Task> callback) noexcept {
+			if constexpr (Execution == execution_e::Parallel) {
+				thread_pool_t::instance().dispatch(static_cast<usize>(region_area), [&](usize i) {
+					callback(offset_t{ extent_t::scalar_cast(i % region_size.w), extent_t::scalar_cast(i / region_size.w) });
+				});
+			} else {
+				for (extent_t::scalar_t y{ 0 }; y < region_size.h; ++y) {
+					for (extent_t::scalar_t x{ 0 }; x < region_size.w; ++x) {
+						callback(offset_t{ x, y });
 					}
 				}
 			}
 		}
 
+	  public:
+		// runs a stencil stage over the region as if it were compiled into a single zone; every iteration first exchanges a one cell halo between neighbouring zones and then steps every zone independently, so the zones may run in parallel without seams.
+		// each zone keeps the two latest generations in turn, so that automatize ties to the generation before the current one exactly as the compiled zone does with a buffer that starts as a copy of its cells
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename Stage>
+			requires Stage::stencil
+		inline ref<region_t> apply_stencil(cref<Stage> stage, u32 iterations = 1) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			if (iterations == 0) {
+				return *this;
+			}
+
+			const T edge{ stage.edge() };
+
+			std::vector<padded_array_t<T, ZoneSize>> halos(static_cast<usize>(region_area) * 2);
+
+			const auto slot{ [&](offset_t region_pos, u32 generation) -> ref<padded_array_t<T, ZoneSize>> {
+				return halos[(static_cast<usize>(region_pos.y) * static_cast<usize>(region_size.w) + static_cast<usize>(region_pos.x)) * 2 + generation % 2];
+			} };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				each_zone<Execution>([&](offset_t region_pos) { exchange(region_pos, slot(region_pos, i), edge); });
+
+				// the first generation has no predecessor, so its ties keep the current cells
+				each_zone<Execution>([&](offset_t region_pos) { step<Region>(region_pos, slot(region_pos, i), slot(region_pos, i == 0 ? i : i + 1), stage); });
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential> inline ref<region_t> automatize(u8 threshold, cref<T> true_state, cref<T> false_state) noexcept {
+			return apply_stencil<Region, Execution>(modulate_stage_t<T>{ threshold, true_state, false_state });
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<region_t> automatize(u8 threshold, cref<U> true_state, cref<U> false_state) noexcept {
+			return apply_stencil<Region, Execution>(modulate_stage_t<T>{ threshold, true_state, false_state });
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential> inline ref<region_t> automatize(u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			return automatize<Region, Execution>(threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<region_t> automatize(u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize<Region, Execution>(threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential> inline ref<region_t> automatize(u32 iterations, u8 threshold, cref<T> true_state, cref<T> false_state) noexcept {
+			return apply_stencil<Region, Execution>(modulate_stage_t<T>{ threshold, true_state, false_state }, iterations);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<region_t> automatize(u32 iterations, u8 threshold, cref<U> true_state, cref<U> false_state) noexcept {
+			return apply_stencil<Region, Execution>(modulate_stage_t<T>{ threshold, true_state, false_state }, iterations);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential> inline ref<region_t> automatize(u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			return automatize<Region, Execution>(iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<region_t> automatize(u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize<Region, Execution>(iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential> inline ref<region_t> collapse(cref<T> value, usize index, cref<T> collapse_to) noexcept {
+			return apply_stencil<Region, Execution>(collapse_stage_t<T>{ value, index, collapse_to });
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<region_t> collapse(cref<U> value, usize index, cref<U> collapse_to) noexcept {
+			return apply_stencil<Region, Execution>(collapse_stage_t<T>{ value, index, collapse_to });
+		}
+
 		template<extent_t AtlasSize>
 			requires is_drawable<T>::value
 		constexpr void draw(ref<renderer_t> renderer, cref<atlas_t<AtlasSize>> atlas) const noexcept {
@@ -199,5 +508,37 @@ namespace bleak {
 				zones[i].deserialize(buffer + i *  zone_type::byte_size);
 			}
 		}
+
+		// writes every zone as its own compressed chunk of an archive, so that single zones may later be read back without the rest
+		inline bool compress(cref<std::string> path) const noexcept {
+			return archive::write(path, archive::type_hash<zone_type>(), zone_type::byte_size, static_cast<usize>(region_area), [&](usize i) -> cptr<u8> { return reinterpret_cast<cptr<u8>>(zones[i].serialize()); });
+		}
+
+		inline bool decompress(cref<std::string> path) noexcept {
+			archive::reader_t reader{ path, archive::type_hash<zone_type>(), zone_type::byte_size };
+
+			// the reader has already logged why it could not open the archive
+			if (!reader.is_valid()) {
+				return false;
+			}
+
+			if (reader.chunk_count() != static_cast<usize>(region_area)) {
+				error_log.add("[ERROR]: zone count mismatch between archive and region!", __TIME_FILE_LINE__);
+				return false;
+			}
+
+			// every chunk is verified into the staging buffer before any zone is replaced
+			std::vector<u8> staging(static_cast<usize>(region_area) * zone_type::byte_size);
+
+			for (extent_t::product_t i{ 0 }; i < region_area; ++i) {
+				if (!reader.read(static_cast<usize>(i), staging.data() + static_cast<usize>(i) * zone_type::byte_size)) {
+					return false;
+				}
+			}
+
+			deserialize(reinterpret_cast<cstr>(staging.data()));
+
+			return true;
+		}
 	};
 } // namespace bleak
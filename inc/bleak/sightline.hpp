@@ -0,0 +1,144 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bit>
+#include <cstdlib>
+#include <span>
+#include <vector>
+
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	// one bit per query of a batch, set where the target of the query is visible from its origin
+	struct visibility_t {
+	  public:
+		static constexpr usize word_bits{ 64 };
+
+		static constexpr usize word_count(usize count) noexcept { return (count + word_bits - 1) / word_bits; }
+
+	  private:
+		std::vector<u64> words;
+		usize count;
+
+	  public:
+		inline visibility_t() noexcept : words{}, count{ 0 } {}
+
+		inline explicit visibility_t(usize count) noexcept : words(word_count(count), 0), count{ count } {}
+
+		inline visibility_t(cref<visibility_t> other) noexcept : words{ other.words }, count{ other.count } {}
+
+		inline visibility_t(rval<visibility_t> other) noexcept : words{ std::move(other.words) }, count{ other.count } {}
+
+		inline ref<visibility_t> operator=(cref<visibility_t> other) noexcept {
+			if (this != &other) {
+				words = other.words;
+				count = other.count;
+			}
+
+			return *this;
+		}
+
+		inline ref<visibility_t> operator=(rval<visibility_t> other) noexcept {
+			if (this != &other) {
+				words = std::move(other.words);
+				count = other.count;
+			}
+
+			return *this;
+		}
+
+		inline ~visibility_t() noexcept {}
+
+		constexpr usize size() const noexcept { return count; }
+
+		constexpr bool empty() const noexcept { return count == 0; }
+
+		constexpr bool test(usize index) const noexcept { return words[index / word_bits] & (u64{ 1 } << (index % word_bits)); }
+
+		constexpr bool operator[](usize index) const noexcept { return test(index); }
+
+		// distinct words may be written from distinct threads
+		constexpr void set(usize index) noexcept { words[index / word_bits] |= u64{ 1 } << (index % word_bits); }
+
+		constexpr void reset(usize index) noexcept { words[index / word_bits] &= ~(u64{ 1 } << (index % word_bits)); }
+
+		constexpr usize visible() const noexcept {
+			usize total{ 0 };
+
+			for (crauto word : words) {
+				total += static_cast<usize>(std::popcount(word));
+			}
+
+			return total;
+		}
+
+		constexpr std::span<const u64> data() const noexcept { return words; }
+	};
+
+	// the cells stepped through by the bresenham walk of zone_t::linear_blockage toward every relative target within range, excluding both endpoints
+	struct ray_table_t {
+	  private:
+		offset_t::scalar_t reach;
+		usize stride;
+
+		std::vector<u32> starts;
+		std::vector<offset_t> steps;
+
+		constexpr usize slot(offset_t delta) const noexcept { return static_cast<usize>(delta.y + reach) * stride + static_cast<usize>(delta.x + reach); }
+
+	  public:
+		inline explicit ray_table_t(offset_t::scalar_t range) noexcept : reach{ range < 0 ? offset_t::scalar_t{ 0 } : range }, stride{ static_cast<usize>(reach) * 2 + 1 }, starts{}, steps{} {
+			starts.reserve(stride * stride + 1);
+
+			for (offset_t::scalar_t y{ offset_t::scalar_cast(-reach) }; y <= reach; ++y) {
+				for (offset_t::scalar_t x{ offset_t::scalar_cast(-reach) }; x <= reach; ++x) {
+					starts.push_back(static_cast<u32>(steps.size()));
+
+					const offset_t target{ x, y };
+
+					const offset_t delta{ std::abs(target.x), std::abs(target.y) };
+
+					const offset_t step{ 0 < target.x ? 1 : -1, 0 < target.y ? 1 : -1 };
+
+					i32 err = delta.x - delta.y;
+
+					offset_t current_position{ 0, 0 };
+
+					for (;;) {
+						i32 e2 = 2 * err;
+
+						if (e2 > -delta.y) {
+							err -= delta.y;
+							current_position.x += step.x;
+						}
+
+						if (e2 < delta.x) {
+							err += delta.x;
+							current_position.y += step.y;
+						}
+
+						if (current_position == target || target == offset_t{ 0, 0 }) {
+							break;
+						}
+
+						steps.push_back(current_position);
+					}
+				}
+			}
+
+			starts.push_back(static_cast<u32>(steps.size()));
+		}
+
+		constexpr offset_t::scalar_t range() const noexcept { return reach; }
+
+		constexpr bool contains(offset_t delta) const noexcept { return std::abs(delta.x) <= reach && std::abs(delta.y) <= reach; }
+
+		// the cells strictly between the origin and the relative target, in walking order; the delta must be contained
+		constexpr std::span<const offset_t> ray(offset_t delta) const noexcept {
+			const usize index{ slot(delta) };
+
+			return std::span<const offset_t>{ steps.data() + starts[index], steps.data() + starts[index + 1] };
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,421 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bit>
+
+// the vector kernels rely on x86 intrinsics and the target attributes of gcc and clang; elsewhere every dispatch takes the scalar kernel
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+	#define BLEAK_SIMD_X86
+	#include <immintrin.h>
+#endif
+
+namespace bleak {
+	namespace simd {
+		enum struct isa_e : u8 {
+			Scalar,
+			SSE2,
+			AVX2
+		};
+
+		inline isa_e detect() noexcept {
+#if defined(BLEAK_SIMD_X86)
+			__builtin_cpu_init();
+
+			if (__builtin_cpu_supports("avx2")) {
+				return isa_e::AVX2;
+			} else if (__builtin_cpu_supports("sse2")) {
+				return isa_e::SSE2;
+			}
+#endif
+			return isa_e::Scalar;
+		}
+
+		inline isa_e isa() noexcept {
+			static const isa_e supported{ detect() };
+
+			return supported;
+		}
+
+		// counts of eight neighbours never exceed nine, so clamping keeps the signed byte compares valid
+		constexpr u8 clamp_threshold(u8 threshold) noexcept { return threshold > 9 ? 9 : threshold; }
+
+		// each row pointer addresses the first cell of the span; the cells immediately before and after the span must be readable
+		inline void modulate_row_scalar(cptr<u8> north, cptr<u8> row, cptr<u8> south, ptr<u8> target, usize count, u8 threshold, u8 true_state, u8 false_state) noexcept {
+			cptr<u8> north_west{ north - 1 };
+			cptr<u8> west{ row - 1 };
+			cptr<u8> south_west{ south - 1 };
+
+			for (usize i{ 0 }; i < count; ++i) {
+				const u8 neighbours = static_cast<u8>(
+					(north_west[i] == true_state) + (north_west[i + 1] == true_state) + (north_west[i + 2] == true_state) +
+					(west[i] == true_state) + (west[i + 2] == true_state) +
+					(south_west[i] == true_state) + (south_west[i + 1] == true_state) + (south_west[i + 2] == true_state)
+				);
+
+				if (neighbours > threshold) {
+					target[i] = true_state;
+				} else if (neighbours < threshold) {
+					target[i] = false_state;
+				}
+			}
+		}
+
+#if defined(BLEAK_SIMD_X86)
+		__attribute__((target("sse2"))) inline void modulate_row_sse2(cptr<u8> north, cptr<u8> row, cptr<u8> south, ptr<u8> target, usize count, u8 threshold, u8 true_state, u8 false_state) noexcept {
+			constexpr usize lanes{ sizeof(__m128i) };
+
+			const __m128i true_vector{ _mm_set1_epi8(static_cast<char>(true_state)) };
+			const __m128i false_vector{ _mm_set1_epi8(static_cast<char>(false_state)) };
+			const __m128i threshold_vector{ _mm_set1_epi8(static_cast<char>(clamp_threshold(threshold))) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				__m128i neighbours{ _mm_setzero_si128() };
+
+				// equal lanes compare to minus one, so subtracting the mask increments the count
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(north + i - 1)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(north + i)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(north + i + 1)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i - 1)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i + 1)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(south + i - 1)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(south + i)), true_vector));
+				neighbours = _mm_sub_epi8(neighbours, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(south + i + 1)), true_vector));
+
+				const __m128i greater{ _mm_cmpgt_epi8(neighbours, threshold_vector) };
+				const __m128i lesser{ _mm_cmpgt_epi8(threshold_vector, neighbours) };
+
+				const __m128i previous{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(target + i)) };
+
+				const __m128i result{
+					_mm_or_si128(
+						_mm_or_si128(_mm_and_si128(greater, true_vector), _mm_and_si128(lesser, false_vector)),
+						_mm_andnot_si128(_mm_or_si128(greater, lesser), previous)
+					)
+				};
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), result);
+			}
+
+			modulate_row_scalar(north + i, row + i, south + i, target + i, count - i, threshold, true_state, false_state);
+		}
+
+		__attribute__((target("avx2"))) inline void modulate_row_avx2(cptr<u8> north, cptr<u8> row, cptr<u8> south, ptr<u8> target, usize count, u8 threshold, u8 true_state, u8 false_state) noexcept {
+			constexpr usize lanes{ sizeof(__m256i) };
+
+			const __m256i true_vector{ _mm256_set1_epi8(static_cast<char>(true_state)) };
+			const __m256i false_vector{ _mm256_set1_epi8(static_cast<char>(false_state)) };
+			const __m256i threshold_vector{ _mm256_set1_epi8(static_cast<char>(clamp_threshold(threshold))) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				__m256i neighbours{ _mm256_setzero_si256() };
+
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(north + i - 1)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(north + i)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(north + i + 1)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i - 1)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i + 1)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(south + i - 1)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(south + i)), true_vector));
+				neighbours = _mm256_sub_epi8(neighbours, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(south + i + 1)), true_vector));
+
+				const __m256i greater{ _mm256_cmpgt_epi8(neighbours, threshold_vector) };
+				const __m256i lesser{ _mm256_cmpgt_epi8(threshold_vector, neighbours) };
+
+				const __m256i previous{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i)) };
+
+				const __m256i result{ _mm256_blendv_epi8(_mm256_blendv_epi8(previous, false_vector, lesser), true_vector, greater) };
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), result);
+			}
+
+			modulate_row_sse2(north + i, row + i, south + i, target + i, count - i, threshold, true_state, false_state);
+		}
+#endif
+
+		inline void modulate_row(cptr<u8> north, cptr<u8> row, cptr<u8> south, ptr<u8> target, usize count, u8 threshold, u8 true_state, u8 false_state) noexcept {
+#if defined(BLEAK_SIMD_X86)
+			switch (isa()) {
+				case isa_e::AVX2: {
+					modulate_row_avx2(north, row, south, target, count, threshold, true_state, false_state);
+					break;
+				} case isa_e::SSE2: {
+					modulate_row_sse2(north, row, south, target, count, threshold, true_state, false_state);
+					break;
+				} default: {
+					modulate_row_scalar(north, row, south, target, count, threshold, true_state, false_state);
+					break;
+				}
+			}
+#else
+			modulate_row_scalar(north, row, south, target, count, threshold, true_state, false_state);
+#endif
+		}
+
+		inline usize count_equal_scalar(cptr<u8> data, usize count, u8 value) noexcept {
+			usize total{ 0 };
+
+			for (usize i{ 0 }; i < count; ++i) {
+				total += data[i] == value;
+			}
+
+			return total;
+		}
+
+#if defined(BLEAK_SIMD_X86)
+		__attribute__((target("sse2"))) inline usize count_equal_sse2(cptr<u8> data, usize count, u8 value) noexcept {
+			constexpr usize lanes{ sizeof(__m128i) };
+
+			// byte lanes overflow after 255 matches, so partial sums are widened at least that often
+			constexpr usize flush_interval{ 255 };
+
+			const __m128i value_vector{ _mm_set1_epi8(static_cast<char>(value)) };
+
+			usize total{ 0 };
+			usize i{ 0 };
+
+			while (i + lanes <= count) {
+				__m128i partial{ _mm_setzero_si128() };
+
+				for (usize j{ 0 }; j < flush_interval && i + lanes <= count; ++j, i += lanes) {
+					partial = _mm_sub_epi8(partial, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), value_vector));
+				}
+
+				const __m128i sums{ _mm_sad_epu8(partial, _mm_setzero_si128()) };
+
+				total += static_cast<usize>(_mm_cvtsi128_si32(sums)) + static_cast<usize>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+			}
+
+			return total + count_equal_scalar(data + i, count - i, value);
+		}
+
+		__attribute__((target("avx2"))) inline usize count_equal_avx2(cptr<u8> data, usize count, u8 value) noexcept {
+			constexpr usize lanes{ sizeof(__m256i) };
+
+			constexpr usize flush_interval{ 255 };
+
+			const __m256i value_vector{ _mm256_set1_epi8(static_cast<char>(value)) };
+
+			usize total{ 0 };
+			usize i{ 0 };
+
+			while (i + lanes <= count) {
+				__m256i partial{ _mm256_setzero_si256() };
+
+				for (usize j{ 0 }; j < flush_interval && i + lanes <= count; ++j, i += lanes) {
+					partial = _mm256_sub_epi8(partial, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), value_vector));
+				}
+
+				const __m256i sums{ _mm256_sad_epu8(partial, _mm256_setzero_si256()) };
+
+				total += static_cast<usize>(_mm256_extract_epi64(sums, 0)) + static_cast<usize>(_mm256_extract_epi64(sums, 1)) +
+						 static_cast<usize>(_mm256_extract_epi64(sums, 2)) + static_cast<usize>(_mm256_extract_epi64(sums, 3));
+			}
+
+			return total + count_equal_sse2(data + i, count - i, value);
+		}
+#endif
+
+		inline usize count_equal(cptr<u8> data, usize count, u8 value) noexcept {
+#if defined(BLEAK_SIMD_X86)
+			switch (isa()) {
+				case isa_e::AVX2: {
+					return count_equal_avx2(data, count, value);
+				} case isa_e::SSE2: {
+					return count_equal_sse2(data, count, value);
+				} default: {
+					return count_equal_scalar(data, count, value);
+				}
+			}
+#else
+			return count_equal_scalar(data, count, value);
+#endif
+		}
+
+		inline bool any_equal_scalar(cptr<u8> data, usize count, u8 value) noexcept {
+			for (usize i{ 0 }; i < count; ++i) {
+				if (data[i] == value) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+#if defined(BLEAK_SIMD_X86)
+		__attribute__((target("sse2"))) inline bool any_equal_sse2(cptr<u8> data, usize count, u8 value) noexcept {
+			constexpr usize lanes{ sizeof(__m128i) };
+
+			const __m128i value_vector{ _mm_set1_epi8(static_cast<char>(value)) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), value_vector)) != 0) {
+					return true;
+				}
+			}
+
+			return any_equal_scalar(data + i, count - i, value);
+		}
+
+		__attribute__((target("avx2"))) inline bool any_equal_avx2(cptr<u8> data, usize count, u8 value) noexcept {
+			constexpr usize lanes{ sizeof(__m256i) };
+
+			const __m256i value_vector{ _mm256_set1_epi8(static_cast<char>(value)) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), value_vector)) != 0) {
+					return true;
+				}
+			}
+
+			return any_equal_sse2(data + i, count - i, value);
+		}
+#endif
+
+		inline bool any_equal(cptr<u8> data, usize count, u8 value) noexcept {
+#if defined(BLEAK_SIMD_X86)
+			switch (isa()) {
+				case isa_e::AVX2: {
+					return any_equal_avx2(data, count, value);
+				} case isa_e::SSE2: {
+					return any_equal_sse2(data, count, value);
+				} default: {
+					return any_equal_scalar(data, count, value);
+				}
+			}
+#else
+			return any_equal_scalar(data, count, value);
+#endif
+		}
+
+		// index of the first byte at which the two spans differ, or the count if they are equal throughout
+		inline usize mismatch_scalar(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+			for (usize i{ 0 }; i < count; ++i) {
+				if (lhs[i] != rhs[i]) {
+					return i;
+				}
+			}
+
+			return count;
+		}
+
+#if defined(BLEAK_SIMD_X86)
+		__attribute__((target("sse2"))) inline usize mismatch_sse2(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+			constexpr usize lanes{ sizeof(__m128i) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				const u32 equal{ static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i))))) };
+
+				if (equal != 0xFFFF) {
+					return i + static_cast<usize>(std::countr_one(equal));
+				}
+			}
+
+			return i + mismatch_scalar(lhs + i, rhs + i, count - i);
+		}
+
+		__attribute__((target("avx2"))) inline usize mismatch_avx2(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+			constexpr usize lanes{ sizeof(__m256i) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				const u32 equal{ static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i))))) };
+
+				if (equal != 0xFFFFFFFF) {
+					return i + static_cast<usize>(std::countr_one(equal));
+				}
+			}
+
+			return i + mismatch_sse2(lhs + i, rhs + i, count - i);
+		}
+#endif
+
+		inline usize mismatch(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+#if defined(BLEAK_SIMD_X86)
+			switch (isa()) {
+				case isa_e::AVX2: {
+					return mismatch_avx2(lhs, rhs, count);
+				} case isa_e::SSE2: {
+					return mismatch_sse2(lhs, rhs, count);
+				} default: {
+					return mismatch_scalar(lhs, rhs, count);
+				}
+			}
+#else
+			return mismatch_scalar(lhs, rhs, count);
+#endif
+		}
+
+		// index of the first byte at which the two spans agree, or the count if they differ throughout
+		inline usize match_scalar(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+			for (usize i{ 0 }; i < count; ++i) {
+				if (lhs[i] == rhs[i]) {
+					return i;
+				}
+			}
+
+			return count;
+		}
+
+#if defined(BLEAK_SIMD_X86)
+		__attribute__((target("sse2"))) inline usize match_sse2(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+			constexpr usize lanes{ sizeof(__m128i) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				const u32 equal{ static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i))))) };
+
+				if (equal != 0) {
+					return i + static_cast<usize>(std::countr_zero(equal));
+				}
+			}
+
+			return i + match_scalar(lhs + i, rhs + i, count - i);
+		}
+
+		__attribute__((target("avx2"))) inline usize match_avx2(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+			constexpr usize lanes{ sizeof(__m256i) };
+
+			usize i{ 0 };
+
+			for (; i + lanes <= count; i += lanes) {
+				const u32 equal{ static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i))))) };
+
+				if (equal != 0) {
+					return i + static_cast<usize>(std::countr_zero(equal));
+				}
+			}
+
+			return i + match_sse2(lhs + i, rhs + i, count - i);
+		}
+#endif
+
+		inline usize match(cptr<u8> lhs, cptr<u8> rhs, usize count) noexcept {
+#if defined(BLEAK_SIMD_X86)
+			switch (isa()) {
+				case isa_e::AVX2: {
+					return match_avx2(lhs, rhs, count);
+				} case isa_e::SSE2: {
+					return match_sse2(lhs, rhs, count);
+				} default: {
+					return match_scalar(lhs, rhs, count);
+				}
+			}
+#else
+			return match_scalar(lhs, rhs, count);
+#endif
+		}
+	} // namespace simd
+} // namespace bleak
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <atomic>
+#include <bit>
+#include <optional>
+#include <vector>
+
+namespace bleak {
+	// a bounded lock-free ring for exactly one producer thread and one consumer thread; the capacity is rounded up to a power of two
+	template<typename T> struct spsc_queue_t {
+	  private:
+		static constexpr usize line_size{ 64 };
+
+		std::vector<T> slots;
+		usize mask;
+
+		// each index is only ever written by one side, and the two are kept on separate cache lines
+		alignas(line_size) std::atomic<usize> head;
+		alignas(line_size) std::atomic<usize> tail;
+
+	  public:
+		inline explicit spsc_queue_t(usize capacity) noexcept : slots(std::bit_ceil(capacity > 1 ? capacity : usize{ 2 })), mask{ slots.size() - 1 }, head{ 0 }, tail{ 0 } {}
+
+		inline spsc_queue_t(cref<spsc_queue_t> other) noexcept = delete;
+		inline spsc_queue_t(rval<spsc_queue_t> other) noexcept = delete;
+
+		inline ref<spsc_queue_t> operator=(cref<spsc_queue_t> other) noexcept = delete;
+		inline ref<spsc_queue_t> operator=(rval<spsc_queue_t> other) noexcept = delete;
+
+		inline ~spsc_queue_t() noexcept {}
+
+		inline usize capacity() const noexcept { return slots.size(); }
+
+		// producer only; returns false without blocking when the ring is full
+		inline bool push(cref<T> value) noexcept {
+			const usize current{ tail.load(std::memory_order_relaxed) };
+
+			if (current - head.load(std::memory_order_acquire) == slots.size()) {
+				return false;
+			}
+
+			slots[current & mask] = value;
+
+			tail.store(current + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		// consumer only; returns nothing without blocking when the ring is empty
+		inline std::optional<T> pop() noexcept {
+			const usize current{ head.load(std::memory_order_relaxed) };
+
+			if (current == tail.load(std::memory_order_acquire)) {
+				return std::nullopt;
+			}
+
+			T value{ slots[current & mask] };
+
+			head.store(current + 1, std::memory_order_release);
+
+			return value;
+		}
+
+		inline bool empty() const noexcept { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+	};
+} // namespace bleak
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	// one step of automatize; off-edge neighbours count as the true state and ties keep the previous generation of the cell where one is given, as the buffer of zone_t::automatize does, or else the current cell
+	template<typename T> struct modulate_stage_t {
+		static constexpr bool stencil{ true };
+
+		u8 threshold;
+
+		T true_state;
+		T false_state;
+
+		constexpr cref<T> edge() const noexcept { return true_state; }
+
+		template<typename U> constexpr U operator()(cptr<U> north, cptr<U> row, cptr<U> south) const noexcept { return (*this)(north, row, south, row[0]); }
+
+		template<typename U> constexpr U operator()(cptr<U> north, cptr<U> row, cptr<U> south, cref<U> previous) const noexcept {
+			const u8 neighbours = static_cast<u8>(
+				(north[-1] == true_state) + (north[0] == true_state) + (north[1] == true_state) +
+				(row[-1] == true_state) + (row[1] == true_state) +
+				(south[-1] == true_state) + (south[0] == true_state) + (south[1] == true_state)
+			);
+
+			if (neighbours > threshold) {
+				return true_state;
+			} else if (neighbours < threshold) {
+				return false_state;
+			}
+
+			return previous;
+		}
+	};
+
+	// one step of collapse; cells holding the value whose melded index matches become the collapsed value
+	template<typename T> struct collapse_stage_t {
+		static constexpr bool stencil{ true };
+
+		T value;
+		usize index;
+		T collapse_to;
+
+		constexpr cref<T> edge() const noexcept { return value; }
+
+		template<typename U> constexpr U operator()(cptr<U> north, cptr<U> row, cptr<U> south) const noexcept {
+			if (row[0] != value) {
+				return row[0];
+			}
+
+			const bool nw{ north[-1] == value };
+			const bool n{ north[0] == value };
+			const bool ne{ north[1] == value };
+
+			const bool w{ row[-1] == value };
+			const bool e{ row[1] == value };
+
+			const bool sw{ south[-1] == value };
+			const bool s{ south[0] == value };
+			const bool se{ south[1] == value };
+
+			const usize melded{ static_cast<usize>(((nw && n && w) << 3) | ((n && ne && e) << 2) | ((e && se && s) << 1) | ((w && sw && s) << 0)) };
+
+			return melded == index ? collapse_to : row[0];
+		}
+
+		// collapse has no ties, so the previous generation goes unused
+		template<typename U> constexpr U operator()(cptr<U> north, cptr<U> row, cptr<U> south, cref<U>) const noexcept { return (*this)(north, row, south); }
+	};
+
+	// an arbitrary per-cell transform of the form mutator(position, value) -> value
+	template<typename Mutator> struct map_stage_t {
+		static constexpr bool stencil{ false };
+
+		Mutator mutator;
+
+		template<typename U> constexpr U operator()(offset_t position, cref<U> value) const noexcept { return mutator(position, value); }
+	};
+
+	template<typename Mutator> map_stage_t(Mutator) -> map_stage_t<Mutator>;
+
+	// streams rows through a chain of stages; every stencil stage holds a window of three rows of its input and lags one row behind it, so no stage needs a full buffer
+	template<typename T, extent_t Size, typename... Stages> struct stencil_pipeline_t {
+		static constexpr usize stage_count{ sizeof...(Stages) };
+
+		static constexpr usize width{ static_cast<usize>(Size.w) };
+		static constexpr usize padded_width{ width + 2 };
+
+		static constexpr extent_t::scalar_t last_row{ extent_t::scalar_cast(Size.h - 1) };
+
+	  private:
+		std::tuple<Stages...> stages;
+
+		// three rows of ring followed by a row of the stage's edge value, each with a single cell of edge on either side
+		std::array<std::vector<T>, stage_count> windows;
+		std::array<std::vector<T>, stage_count> outputs;
+
+		constexpr ptr<T> slot(usize stage, usize index) noexcept { return windows[stage].data() + index * padded_width + 1; }
+
+		constexpr ptr<T> window_row(usize stage, extent_t::scalar_t y) noexcept { return slot(stage, static_cast<usize>(y) % 3); }
+
+		constexpr ptr<T> edge_row(usize stage) noexcept { return slot(stage, 3); }
+
+		template<usize I> constexpr void initialize() noexcept {
+			if constexpr (I < stage_count) {
+				outputs[I].resize(width);
+
+				using stage_t = std::tuple_element_t<I, std::tuple<Stages...>>;
+
+				if constexpr (stage_t::stencil) {
+					windows[I].assign(padded_width * 4, static_cast<T>(std::get<I>(stages).edge()));
+				}
+
+				initialize<I + 1>();
+			}
+		}
+
+		template<usize I, typename Covers, typename Sink> constexpr void emit(extent_t::scalar_t y, bool last, rval<Covers> covers, rval<Sink> sink) noexcept {
+			cref<std::tuple_element_t<I, std::tuple<Stages...>>> stage{ std::get<I>(stages) };
+
+			cptr<T> north{ y == 0 ? edge_row(I) : window_row(I, extent_t::scalar_cast(y - 1)) };
+			cptr<T> row{ window_row(I, y) };
+			cptr<T> south{ last ? edge_row(I) : window_row(I, extent_t::scalar_cast(y + 1)) };
+
+			ptr<T> output{ outputs[I].data() };
+
+			for (usize x{ 0 }; x < width; ++x) {
+				output[x] = covers(offset_t{ extent_t::scalar_cast(x), y }) ? static_cast<T>(stage(north + x, row + x, south + x)) : row[x];
+			}
+
+			push<I + 1>(y, output, std::forward<Covers>(covers), std::forward<Sink>(sink));
+		}
+
+	  public:
+		constexpr explicit stencil_pipeline_t(cref<Stages>... chain) noexcept : stages{ chain... }, windows{}, outputs{} { initialize<0>(); }
+
+		// delivers row y of the input to the stage; rows must arrive in order
+		template<usize I, typename Covers, typename Sink> constexpr void push(extent_t::scalar_t y, cptr<T> input, rval<Covers> covers, rval<Sink> sink) noexcept {
+			if constexpr (I == stage_count) {
+				sink(y, input);
+			} else {
+				using stage_t = std::tuple_element_t<I, std::tuple<Stages...>>;
+
+				if constexpr (stage_t::stencil) {
+					std::copy_n(input, width, window_row(I, y));
+
+					if (y > 0) {
+						emit<I>(extent_t::scalar_cast(y - 1), false, std::forward<Covers>(covers), std::forward<Sink>(sink));
+					}
+				} else {
+					cref<stage_t> stage{ std::get<I>(stages) };
+
+					ptr<T> output{ outputs[I].data() };
+
+					for (usize x{ 0 }; x < width; ++x) {
+						const offset_t position{ extent_t::scalar_cast(x), y };
+
+						output[x] = covers(position) ? static_cast<T>(stage(position, input[x])) : input[x];
+					}
+
+					push<I + 1>(y, output, std::forward<Covers>(covers), std::forward<Sink>(sink));
+				}
+			}
+		}
+
+		// drains the final row held back by each stencil stage once the last input row has been pushed
+		template<usize I, typename Covers, typename Sink> constexpr void finish(rval<Covers> covers, rval<Sink> sink) noexcept {
+			if constexpr (I < stage_count) {
+				using stage_t = std::tuple_element_t<I, std::tuple<Stages...>>;
+
+				if constexpr (stage_t::stencil) {
+					emit<I>(last_row, true, std::forward<Covers>(covers), std::forward<Sink>(sink));
+				}
+
+				finish<I + 1>(std::forward<Covers>(covers), std::forward<Sink>(sink));
+			}
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(__linux__)
+	#include <sys/mman.h>
+#endif
+
+#include <bleak/layout.hpp>
+#include <bleak/log.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// a fixed-capacity buffer owned through a single allocation; moves transfer the allocation and leave the source empty until it is assigned to again
+	// a failed allocation is logged and likewise leaves the buffer empty, as the constructors of the arrays built upon it cannot throw
+	template<typename T, usize Capacity, typename Allocator> struct heap_buffer_t {
+	  public:
+		using allocator_t = std::allocator_traits<Allocator>::template rebind_alloc<T>;
+		using traits_t = std::allocator_traits<allocator_t>;
+
+	  private:
+		[[no_unique_address]] allocator_t allocator;
+
+		ptr<T> handle;
+
+		constexpr bool acquire() noexcept {
+			try {
+				handle = traits_t::allocate(allocator, Capacity);
+			} catch (cref<std::bad_alloc>) {
+				error_log.add("[ERROR]: failed to allocate heap buffer!", __TIME_FILE_LINE__);
+
+				handle = nullptr;
+			}
+
+			return handle != nullptr;
+		}
+
+		constexpr void release() noexcept {
+			if (handle == nullptr) {
+				return;
+			}
+
+			std::destroy_n(handle, Capacity);
+			traits_t::deallocate(allocator, handle, Capacity);
+
+			handle = nullptr;
+		}
+
+		constexpr ptr<T> checked() const noexcept {
+			assert(handle != nullptr);
+
+			return handle;
+		}
+
+	  public:
+		constexpr heap_buffer_t() noexcept : allocator{}, handle{ nullptr } {
+			if (acquire()) {
+				std::uninitialized_value_construct_n(handle, Capacity);
+			}
+		}
+
+		constexpr heap_buffer_t(cref<heap_buffer_t> other) noexcept : allocator{ other.allocator }, handle{ nullptr } {
+			if (!other.empty() && acquire()) {
+				std::uninitialized_copy_n(other.handle, Capacity, handle);
+			}
+		}
+
+		constexpr heap_buffer_t(rval<heap_buffer_t> other) noexcept : allocator{ std::move(other.allocator) }, handle{ std::exchange(other.handle, nullptr) } {}
+
+		constexpr ref<heap_buffer_t> operator=(cref<heap_buffer_t> other) noexcept {
+			if (this == &other) {
+				return *this;
+			}
+
+			if (other.empty()) {
+				release();
+
+				return *this;
+			}
+
+			if (handle == nullptr) {
+				if (!acquire()) {
+					return *this;
+				}
+
+				std::uninitialized_copy_n(other.handle, Capacity, handle);
+
+				return *this;
+			}
+
+			std::copy_n(other.handle, Capacity, handle);
+
+			return *this;
+		}
+
+		constexpr ref<heap_buffer_t> operator=(rval<heap_buffer_t> other) noexcept {
+			if (this == &other) {
+				return *this;
+			}
+
+			std::swap(allocator, other.allocator);
+			std::swap(handle, other.handle);
+
+			return *this;
+		}
+
+		constexpr ~heap_buffer_t() noexcept { release(); }
+
+		static constexpr usize size() noexcept { return Capacity; }
+
+		constexpr bool empty() const noexcept { return handle == nullptr; }
+
+		constexpr ref<T> operator[](usize index) noexcept { return checked()[index]; }
+
+		constexpr cref<T> operator[](usize index) const noexcept { return checked()[index]; }
+
+		constexpr ptr<T> data() noexcept { return checked(); }
+
+		constexpr cptr<T> data() const noexcept { return checked(); }
+
+		constexpr ptr<T> begin() noexcept { return checked(); }
+
+		constexpr ptr<T> end() noexcept { return checked() + Capacity; }
+
+		constexpr cptr<T> begin() const noexcept { return checked(); }
+
+		constexpr cptr<T> end() const noexcept { return checked() + Capacity; }
+
+		constexpr cptr<T> cbegin() const noexcept { return begin(); }
+
+		constexpr cptr<T> cend() const noexcept { return end(); }
+
+		constexpr std::reverse_iterator<ptr<T>> rbegin() noexcept { return std::reverse_iterator<ptr<T>>{ end() }; }
+
+		constexpr std::reverse_iterator<ptr<T>> rend() noexcept { return std::reverse_iterator<ptr<T>>{ begin() }; }
+
+		constexpr std::reverse_iterator<cptr<T>> rbegin() const noexcept { return std::reverse_iterator<cptr<T>>{ end() }; }
+
+		constexpr std::reverse_iterator<cptr<T>> rend() const noexcept { return std::reverse_iterator<cptr<T>>{ begin() }; }
+
+		constexpr std::reverse_iterator<cptr<T>> crbegin() const noexcept { return rbegin(); }
+
+		constexpr std::reverse_iterator<cptr<T>> crend() const noexcept { return rend(); }
+
+		constexpr void fill(cref<T> value) noexcept { std::fill_n(checked(), Capacity, value); }
+	};
+
+	// hands out whole, huge-page aligned mappings and asks the kernel to back them with transparent huge pages where it is able
+	// like std::allocator it never returns null; exhaustion is reported through std::bad_alloc
+	template<typename T> struct huge_page_allocator_t {
+		using value_type = T;
+
+		static constexpr usize page_size{ memory::Megabyte * 2 };
+
+		static constexpr usize mapping_size(usize count) noexcept { return (count * sizeof(T) + page_size - 1) / page_size * page_size; }
+
+		constexpr huge_page_allocator_t() noexcept = default;
+
+		template<typename U> constexpr huge_page_allocator_t(cref<huge_page_allocator_t<U>>) noexcept {}
+
+		inline ptr<T> allocate(usize count) {
+			const usize bytes{ mapping_size(count) };
+
+#if defined(__linux__)
+			ptr<void> mapping{ mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+
+			if (mapping == MAP_FAILED) {
+				error_log.add("[ERROR]: failed to map memory for huge page allocation.", __TIME_FILE_LINE__);
+				throw std::bad_alloc{};
+			}
+
+			madvise(mapping, bytes, MADV_HUGEPAGE);
+
+			return static_cast<ptr<T>>(mapping);
+#else
+			return static_cast<ptr<T>>(::operator new(bytes, std::align_val_t{ page_size }));
+#endif
+		}
+
+		inline void deallocate(ptr<T> pointer, usize count) noexcept {
+#if defined(__linux__)
+			munmap(pointer, mapping_size(count));
+#else
+			::operator delete(pointer, std::align_val_t{ page_size });
+#endif
+		}
+
+		template<typename U> constexpr bool operator==(cref<huge_page_allocator_t<U>>) const noexcept { return true; }
+	};
+
+	// places the cells of an array in a heap allocation from the allocator rather than inline, while indexing them as the underlying layout does
+	template<typename Layout = row_major_layout_t, typename Allocator = std::allocator<u8>> struct heap_storage_t : Layout {
+		template<typename T, usize Capacity> using container_t = heap_buffer_t<T, Capacity, Allocator>;
+	};
+
+	template<typename Layout = row_major_layout_t> using huge_page_storage_t = heap_storage_t<Layout, huge_page_allocator_t<u8>>;
+} // namespace bleak
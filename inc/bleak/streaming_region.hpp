@@ -0,0 +1,369 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bleak/archive.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/log.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/spsc_queue.hpp>
+#include <bleak/utility.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// a read-only region backed by a serialized region file or archive, of which only the zones near a focus are resident; zones are read on a background thread into a fixed pool sized by the memory budget and evicted least recently used first
+	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder> struct streaming_region_t {
+	  public:
+		using zone_type = zone_t<T, ZoneSize, ZoneBorder>;
+
+		static constexpr extent_t region_size{ RegionSize };
+		static constexpr extent_t zone_size{ ZoneSize };
+
+		static constexpr usize region_area{ static_cast<usize>(region_size.area()) };
+
+		static constexpr u32 absent{ 0xFFFFFFFF };
+
+	  private:
+		struct request_t {
+			u32 zone;
+			u32 slot;
+		};
+
+		struct result_t {
+			u32 zone;
+			u32 slot;
+			bool loaded;
+		};
+
+		struct slot_t {
+			u32 zone;
+			u64 last_used;
+			u32 pins;
+			bool pending;
+		};
+
+		std::string path;
+		bool compressed;
+
+		extent_t::scalar_t reach;
+
+		// the pool and the slot table belong to the main thread, except that a pending slot's zone belongs to the loader until its result is handed back
+		std::vector<zone_type> pool;
+		std::vector<slot_t> slots;
+		std::vector<u32> residency;
+
+		spsc_queue_t<request_t> requests;
+		spsc_queue_t<result_t> results;
+
+		std::atomic<u32> signal;
+		std::atomic<bool> running;
+
+		u64 tick;
+
+		std::thread loader;
+
+		static constexpr usize slot_count(usize budget) noexcept { return clamp<usize>(budget / sizeof(zone_type), 1, region_area); }
+
+		static constexpr u32 index(offset_t zone_position) noexcept { return static_cast<u32>(zone_position.y) * static_cast<u32>(region_size.w) + static_cast<u32>(zone_position.x); }
+
+		static constexpr bool contains(offset_t zone_position) noexcept { return zone_position.x >= 0 && zone_position.y >= 0 && zone_position.x < region_size.w && zone_position.y < region_size.h; }
+
+		inline void load() noexcept {
+			std::optional<archive::reader_t> reader{};
+			std::ifstream file{};
+
+			if (compressed) {
+				reader.emplace(path, archive::type_hash<zone_type>(), zone_type::byte_size);
+			} else {
+				file.open(path, std::ios::in | std::ios::binary);
+			}
+
+			for (;;) {
+				// observed before running is checked, so a stop that lands after the check has also moved the signal on and the wait below returns at once
+				const u32 observed{ signal.load(std::memory_order_acquire) };
+
+				if (!running.load(std::memory_order_acquire)) {
+					return;
+				}
+
+				while (cauto request{ requests.pop() }) {
+					ref<zone_type> zone{ pool[request->slot] };
+
+					bool loaded{ false };
+
+					if (compressed) {
+						loaded = zone.decompress(*reader, request->zone);
+					} else {
+						file.clear();
+						file.seekg(static_cast<std::streamoff>(request->zone) * static_cast<std::streamoff>(zone_type::byte_size), std::ios::beg);
+
+						loaded = zone.deserialize(file);
+					}
+
+					// never full, as no more requests may be outstanding than there are slots
+					results.push(result_t{ request->zone, request->slot, loaded });
+				}
+
+				signal.wait(observed, std::memory_order_acquire);
+			}
+		}
+
+		inline void wake() noexcept {
+			signal.fetch_add(1, std::memory_order_release);
+			signal.notify_one();
+		}
+
+		// a free slot if one remains, otherwise the least recently used slot that is neither loading, pinned by a handle nor wanted by the current focus
+		inline u32 claim() noexcept {
+			u32 victim{ absent };
+
+			for (u32 i{ 0 }; i < slots.size(); ++i) {
+				cref<slot_t> slot{ slots[i] };
+
+				if (slot.zone == absent) {
+					return i;
+				}
+
+				if (slot.pending || slot.pins != 0 || slot.last_used == tick) {
+					continue;
+				}
+
+				if (victim == absent || slot.last_used < slots[victim].last_used) {
+					victim = i;
+				}
+			}
+
+			if (victim != absent) {
+				residency[slots[victim].zone] = absent;
+			}
+
+			return victim;
+		}
+
+	  public:
+		// pins a resident zone so that it is neither evicted nor overwritten while the handle lives; it must not outlive the region and belongs to the thread that calls focus
+		struct handle_t {
+		  private:
+			ptr<streaming_region_t> region;
+			u32 slot;
+
+			inline handle_t(ptr<streaming_region_t> region, u32 slot) noexcept : region{ region }, slot{ slot } { ++region->slots[slot].pins; }
+
+			friend struct streaming_region_t;
+
+		  public:
+			inline handle_t() noexcept : region{ nullptr }, slot{ absent } {}
+
+			inline handle_t(cref<handle_t> other) noexcept = delete;
+
+			inline handle_t(rval<handle_t> other) noexcept : region{ std::exchange(other.region, nullptr) }, slot{ std::exchange(other.slot, absent) } {}
+
+			inline ref<handle_t> operator=(cref<handle_t> other) noexcept = delete;
+
+			inline ref<handle_t> operator=(rval<handle_t> other) noexcept {
+				if (this != &other) {
+					release();
+
+					region = std::exchange(other.region, nullptr);
+					slot = std::exchange(other.slot, absent);
+				}
+
+				return *this;
+			}
+
+			inline ~handle_t() noexcept { release(); }
+
+			inline void release() noexcept {
+				if (region == nullptr) {
+					return;
+				}
+
+				--region->slots[slot].pins;
+
+				region = nullptr;
+				slot = absent;
+			}
+
+			inline explicit operator bool() const noexcept { return region != nullptr; }
+
+			inline cref<zone_type> operator*() const noexcept { return region->pool[slot]; }
+
+			inline cptr<zone_type> operator->() const noexcept { return &region->pool[slot]; }
+		};
+
+		// the reach is the radius in zones around the focus that is kept resident
+		inline streaming_region_t(cref<std::string> path, usize budget, extent_t::scalar_t reach = 1) noexcept :
+			path{ path },
+			compressed{ archive::is_archive(path) },
+			reach{ reach },
+			pool(slot_count(budget)),
+			slots(slot_count(budget), slot_t{ absent, 0, 0, false }),
+			residency(region_area, absent),
+			requests{ slot_count(budget) },
+			results{ slot_count(budget) },
+			signal{ 0 },
+			running{ true },
+			tick{ 0 },
+			loader{ [this]() { load(); } } {
+			if ((reach * 2 + 1) * (reach * 2 + 1) > static_cast<extent_t::product_t>(slots.size())) {
+				error_log.add("[WARNING]: memory budget cannot hold every zone within reach of the focus!", __TIME_FILE_LINE__);
+			}
+		}
+
+		inline streaming_region_t(cref<streaming_region_t> other) noexcept = delete;
+		inline streaming_region_t(rval<streaming_region_t> other) noexcept = delete;
+
+		inline ref<streaming_region_t> operator=(cref<streaming_region_t> other) noexcept = delete;
+		inline ref<streaming_region_t> operator=(rval<streaming_region_t> other) noexcept = delete;
+
+		inline ~streaming_region_t() noexcept {
+			running.store(false, std::memory_order_release);
+			wake();
+
+			loader.join();
+		}
+
+		inline usize capacity() const noexcept { return slots.size(); }
+
+		// requests every zone within reach of the cell position, nearest rings first, evicting as needed; call from the same thread as update
+		inline void focus(offset_t position) noexcept {
+			const offset_t center{ position / zone_size };
+
+			++tick;
+
+			for (extent_t::scalar_t y{ extent_t::scalar_cast(center.y - reach) }; y <= center.y + reach; ++y) {
+				for (extent_t::scalar_t x{ extent_t::scalar_cast(center.x - reach) }; x <= center.x + reach; ++x) {
+					const offset_t zone_position{ x, y };
+
+					if (contains(zone_position) && residency[index(zone_position)] != absent) {
+						slots[residency[index(zone_position)]].last_used = tick;
+					}
+				}
+			}
+
+			bool requested{ false };
+
+			for (extent_t::scalar_t ring{ 0 }; ring <= reach; ++ring) {
+				for (extent_t::scalar_t y{ extent_t::scalar_cast(center.y - ring) }; y <= center.y + ring; ++y) {
+					for (extent_t::scalar_t x{ extent_t::scalar_cast(center.x - ring) }; x <= center.x + ring; ++x) {
+						if (max(std::abs(x - center.x), std::abs(y - center.y)) != ring) {
+							continue;
+						}
+
+						const offset_t zone_position{ x, y };
+
+						if (!contains(zone_position) || residency[index(zone_position)] != absent) {
+							continue;
+						}
+
+						const u32 slot{ claim() };
+
+						if (slot == absent) {
+							if (requested) {
+								wake();
+							}
+
+							return;
+						}
+
+						slots[slot] = slot_t{ index(zone_position), tick, 0, true };
+						residency[index(zone_position)] = slot;
+
+						requests.push(request_t{ index(zone_position), slot });
+
+						requested = true;
+					}
+				}
+			}
+
+			if (requested) {
+				wake();
+			}
+		}
+
+		// takes delivery of every zone the loader has finished since the last call and returns how many arrived
+		inline usize update() noexcept {
+			usize arrived{ 0 };
+
+			while (cauto result{ results.pop() }) {
+				ref<slot_t> slot{ slots[result->slot] };
+
+				slot.pending = false;
+
+				if (!result->loaded) {
+					error_log.add("[ERROR]: failed to stream zone from region file!", __TIME_FILE_LINE__);
+
+					residency[result->zone] = absent;
+					slot.zone = absent;
+
+					continue;
+				}
+
+				++arrived;
+			}
+
+			return arrived;
+		}
+
+		// blocks until every outstanding request has been delivered
+		inline void flush() noexcept {
+			for (;;) {
+				update();
+
+				bool pending{ false };
+
+				for (crauto slot : slots) {
+					pending |= slot.pending;
+				}
+
+				if (!pending) {
+					return;
+				}
+
+				std::this_thread::yield();
+			}
+		}
+
+		inline bool is_resident(offset_t zone_position) const noexcept {
+			if (!contains(zone_position)) {
+				return false;
+			}
+
+			const u32 slot{ residency[index(zone_position)] };
+
+			return slot != absent && !slots[slot].pending;
+		}
+
+		// a handle pinning the zone if it is resident, which also counts as a use for eviction; otherwise an empty handle
+		inline handle_t find(offset_t zone_position) noexcept {
+			if (!is_resident(zone_position)) {
+				return handle_t{};
+			}
+
+			const u32 slot{ residency[index(zone_position)] };
+
+			slots[slot].last_used = tick;
+
+			return handle_t{ this, slot };
+		}
+
+		// a copy of the cell, as nothing is pinned once the lookup returns
+		inline std::optional<T> find(offset_t zone_position, offset_t cell_position) noexcept {
+			const handle_t zone{ find(zone_position) };
+
+			if (!zone) {
+				return std::nullopt;
+			}
+
+			return (*zone)[cell_position];
+		}
+	};
+} // namespace bleak
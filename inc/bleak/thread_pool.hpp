@@ -0,0 +1,156 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	struct thread_pool_t {
+	  private:
+		std::vector<std::thread> workers{};
+
+		std::mutex dispatching{};
+
+		std::mutex access{};
+		std::condition_variable wake{};
+		std::condition_variable done{};
+
+		std::function<void(usize)> task{};
+
+		usize task_count{ 0 };
+		usize next_task{ 0 };
+		usize remaining{ 0 };
+
+		u64 generation{ 0 };
+
+		bool stopping{ false };
+
+		// set on workers and on a thread for as long as it dispatches, so that a task which dispatches again runs its tasks inline instead of waiting on the pool it occupies
+		static inline thread_local bool inside{ false };
+
+		// runs tasks until none are left to claim; the lock must be held on entry and is held on return
+		inline void drain(ref<std::unique_lock<std::mutex>> lock) noexcept {
+			while (next_task < task_count) {
+				const usize current{ next_task++ };
+
+				lock.unlock();
+				task(current);
+				lock.lock();
+
+				if (--remaining == 0) {
+					done.notify_all();
+				}
+			}
+		}
+
+		inline void work() noexcept {
+			inside = true;
+
+			u64 seen{ 0 };
+
+			for (;;) {
+				std::unique_lock lock{ access };
+
+				wake.wait(lock, [&]() -> bool { return stopping || generation != seen; });
+
+				if (stopping) {
+					return;
+				}
+
+				seen = generation;
+
+				drain(lock);
+			}
+		}
+
+	  public:
+		inline explicit thread_pool_t(usize count = std::thread::hardware_concurrency()) noexcept {
+			// the dispatching thread always participates, so it counts towards the total
+			const usize worker_count{ count > 1 ? count - 1 : 0 };
+
+			workers.reserve(worker_count);
+
+			for (usize i{ 0 }; i < worker_count; ++i) {
+				workers.emplace_back([this]() { work(); });
+			}
+		}
+
+		inline thread_pool_t(cref<thread_pool_t> other) noexcept = delete;
+		inline thread_pool_t(rval<thread_pool_t> other) noexcept = delete;
+
+		inline ref<thread_pool_t> operator=(cref<thread_pool_t> other) noexcept = delete;
+		inline ref<thread_pool_t> operator=(rval<thread_pool_t> other) noexcept = delete;
+
+		inline ~thread_pool_t() noexcept {
+			{
+				std::lock_guard lock{ access };
+				stopping = true;
+			}
+
+			wake.notify_all();
+
+			for (rauto worker : workers) {
+				worker.join();
+			}
+		}
+
+		static inline ref<thread_pool_t> instance() noexcept {
+			static thread_pool_t pool{};
+
+			return pool;
+		}
+
+		inline usize concurrency() const noexcept { return workers.size() + 1; }
+
+		// invokes callback(i) for every i in [0, count) across the pool and blocks until all have returned
+		template<typename Task> inline void dispatch(usize count, rval<Task> callback) noexcept {
+			if (count == 0) {
+				return;
+			}
+
+			if (workers.empty() || count == 1 || inside) {
+				for (usize i{ 0 }; i < count; ++i) {
+					callback(i);
+				}
+
+				return;
+			}
+
+			std::lock_guard guard{ dispatching };
+			std::unique_lock lock{ access };
+
+			inside = true;
+
+			task = std::ref(callback);
+
+			task_count = count;
+			next_task = 0;
+			remaining = count;
+
+			++generation;
+
+			wake.notify_all();
+
+			drain(lock);
+
+			done.wait(lock, [&]() -> bool { return remaining == 0; });
+
+			task = nullptr;
+
+			inside = false;
+		}
+
+		// splits [0, count) into one contiguous band per thread and invokes callback(first, last) on each
+		template<typename Task> inline void partition(usize count, rval<Task> callback) noexcept {
+			const usize bands{ min(concurrency(), count) };
+
+			dispatch(bands, [&](usize band) { callback(count * band / bands, count * (band + 1) / bands); });
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <bit>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <bleak/array.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/random.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// a zone that maintains a dense per-value index of cell positions so that count, contains and find_random are constant time; writes must go through the tracked interface
+	template<Trackable T, extent_t Size, extent_t BorderSize = extent_t::Zero> struct tracked_zone_t {
+	  public:
+		using zone_type = zone_t<T, Size, BorderSize>;
+
+		static constexpr usize domain{ usize{ 1 } << (sizeof(T) * 8) };
+
+	  private:
+		zone_type zone;
+
+		std::array<std::vector<offset_t>, domain> interior_positions;
+		std::array<std::vector<offset_t>, domain> border_positions;
+
+		// index of each cell within the position list of its current value
+		array_t<u32, Size> slots;
+
+		static constexpr usize bucket(cref<T> value) noexcept { return std::bit_cast<u8>(value); }
+
+		constexpr ref<std::vector<offset_t>> positions_of(offset_t position, usize index) noexcept {
+			return zone.template within<region_e::Interior>(position) ? interior_positions[index] : border_positions[index];
+		}
+
+		constexpr void insert(offset_t position, usize index) noexcept {
+			rauto positions{ positions_of(position, index) };
+
+			slots[position] = static_cast<u32>(positions.size());
+			positions.push_back(position);
+		}
+
+		constexpr void erase(offset_t position, usize index) noexcept {
+			rauto positions{ positions_of(position, index) };
+
+			const u32 slot{ slots[position] };
+			const offset_t last{ positions.back() };
+
+			positions[slot] = last;
+			slots[last] = slot;
+
+			positions.pop_back();
+		}
+
+		constexpr void write(offset_t position, cref<T> value) noexcept {
+			const usize previous{ bucket(zone[position]) };
+			const usize current{ bucket(value) };
+
+			zone[position] = value;
+
+			if (previous == current) {
+				return;
+			}
+
+			erase(position, previous);
+			insert(position, current);
+		}
+
+		template<region_e Region> constexpr usize candidate_count(usize index) const noexcept {
+			if constexpr (Region == region_e::All) {
+				return interior_positions[index].size() + border_positions[index].size();
+			} else if constexpr (Region == region_e::Interior) {
+				return interior_positions[index].size();
+			} else if constexpr (Region == region_e::Border) {
+				return border_positions[index].size();
+			}
+
+			return 0;
+		}
+
+		template<region_e Region> constexpr offset_t candidate(usize index, usize i) const noexcept {
+			if constexpr (Region == region_e::All) {
+				cref<std::vector<offset_t>> interior{ interior_positions[index] };
+
+				return i < interior.size() ? interior[i] : border_positions[index][i - interior.size()];
+			} else if constexpr (Region == region_e::Interior) {
+				return interior_positions[index][i];
+			} else {
+				return border_positions[index][i];
+			}
+		}
+
+	  public:
+		struct cell_t {
+		  private:
+			ref<tracked_zone_t> owner;
+			offset_t position;
+
+		  public:
+			constexpr cell_t(ref<tracked_zone_t> owner, offset_t position) noexcept : owner{ owner }, position{ position } {}
+
+			constexpr operator T() const noexcept { return owner.zone[position]; }
+
+			constexpr ref<cell_t> operator=(cref<T> value) noexcept {
+				owner.write(position, value);
+
+				return *this;
+			}
+
+			constexpr ref<cell_t> operator=(cref<cell_t> other) noexcept {
+				owner.write(position, static_cast<T>(other));
+
+				return *this;
+			}
+		};
+
+		constexpr tracked_zone_t() noexcept : zone{}, interior_positions{}, border_positions{}, slots{} { recount(); }
+
+		constexpr explicit tracked_zone_t(cref<zone_type> other) noexcept : zone{ other }, interior_positions{}, border_positions{}, slots{} { recount(); }
+
+		constexpr explicit tracked_zone_t(rval<zone_type> other) noexcept : zone{ std::move(other) }, interior_positions{}, border_positions{}, slots{} { recount(); }
+
+		constexpr tracked_zone_t(cref<tracked_zone_t> other) noexcept : zone{ other.zone }, interior_positions{ other.interior_positions }, border_positions{ other.border_positions }, slots{ other.slots } {}
+
+		constexpr tracked_zone_t(rval<tracked_zone_t> other) noexcept : zone{ std::move(other.zone) }, interior_positions{ std::move(other.interior_positions) }, border_positions{ std::move(other.border_positions) }, slots{ std::move(other.slots) } {}
+
+		constexpr ref<tracked_zone_t> operator=(cref<tracked_zone_t> other) noexcept {
+			if (this != &other) {
+				zone = other.zone;
+				interior_positions = other.interior_positions;
+				border_positions = other.border_positions;
+				slots = other.slots;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<tracked_zone_t> operator=(rval<tracked_zone_t> other) noexcept {
+			if (this != &other) {
+				zone = std::move(other.zone);
+				interior_positions = std::move(other.interior_positions);
+				border_positions = std::move(other.border_positions);
+				slots = std::move(other.slots);
+			}
+
+			return *this;
+		}
+
+		constexpr ~tracked_zone_t() noexcept {}
+
+		constexpr cref<zone_type> get() const noexcept { return zone; }
+
+		constexpr operator cref<zone_type>() const noexcept { return zone; }
+
+		constexpr cell_t operator[](offset_t position) noexcept { return cell_t{ *this, position }; }
+
+		constexpr cref<T> operator[](offset_t position) const noexcept { return zone[position]; }
+
+		constexpr cell_t operator[](extent_t::scalar_t x, extent_t::scalar_t y) noexcept { return cell_t{ *this, offset_t{ x, y } }; }
+
+		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return zone[x, y]; }
+
+		// rebuilds the index from a full scan of the zone
+		constexpr void recount() noexcept {
+			for (usize i{ 0 }; i < domain; ++i) {
+				interior_positions[i].clear();
+				border_positions[i].clear();
+			}
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_type::zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < zone_type::zone_size.w; ++x) {
+					const offset_t position{ x, y };
+
+					insert(position, bucket(zone[position]));
+				}
+			}
+		}
+
+		template<region_e Region> constexpr ref<tracked_zone_t> set(cref<T> value) noexcept {
+			zone.template set<Region>(value);
+			recount();
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<tracked_zone_t> apply(cref<T> value) noexcept {
+			zone.template apply<Region>(value);
+			recount();
+
+			return *this;
+		}
+
+		constexpr void swap(ref<array_t<T, Size>> buffer) noexcept {
+			zone.swap(buffer);
+			recount();
+		}
+
+		constexpr void sync(cref<array_t<T, Size>> buffer) noexcept {
+			zone.sync(buffer);
+			recount();
+		}
+
+		// runs an arbitrary bulk operation against the underlying zone, such as generate or automatize, and then recounts
+		template<typename Mutator> constexpr ref<tracked_zone_t> modify(rval<Mutator> mutator) noexcept {
+			mutator(zone);
+			recount();
+
+			return *this;
+		}
+
+		// border counts are taken as every cell outside of the interior
+		template<region_e Region> constexpr u32 count(cref<T> value) const noexcept { return static_cast<u32>(candidate_count<Region>(bucket(value))); }
+
+		template<region_e Region> constexpr bool contains(cref<T> value) const noexcept { return count<Region>(value) > 0; }
+
+		// uniformly samples a cell holding the value; only fails if no such cell exists
+		template<region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr std::optional<offset_t> find_random(ref<Randomizer> generator, cref<T> value) const noexcept {
+			const usize index{ bucket(value) };
+			const usize total{ candidate_count<Region>(index) };
+
+			if (total == 0) {
+				return std::nullopt;
+			}
+
+			std::uniform_int_distribution<usize> dis{ 0, total - 1 };
+
+			return candidate<Region>(index, dis(generator));
+		}
+
+		// samples uniformly among the candidates until one is unblocked, then falls back to a uniform sweep so that failure means every candidate is blocked
+		template<region_e Region, RandomEngine Randomizer, SparseBlockage... Blockages>
+			requires is_random_engine<Randomizer>::value && (sizeof...(Blockages) > 0)
+		constexpr std::optional<offset_t> find_random(ref<Randomizer> generator, cref<T> value, cref<Blockages>... blockages) const noexcept {
+			const usize index{ bucket(value) };
+			const usize total{ candidate_count<Region>(index) };
+
+			if (total == 0) {
+				return std::nullopt;
+			}
+
+			std::uniform_int_distribution<usize> dis{ 0, total - 1 };
+
+			for (usize i{ 0 }; i < total; ++i) {
+				const offset_t position{ candidate<Region>(index, dis(generator)) };
+
+				if (!(blockages.contains(position) || ...)) {
+					return position;
+				}
+			}
+
+			// reservoir sampling keeps the sweep uniform, where taking the first unblocked candidate would favour those after long blocked runs
+			std::optional<offset_t> chosen{ std::nullopt };
+
+			usize unblocked{ 0 };
+
+			for (usize i{ 0 }; i < total; ++i) {
+				const offset_t position{ candidate<Region>(index, i) };
+
+				if ((blockages.contains(position) || ...)) {
+					continue;
+				}
+
+				++unblocked;
+
+				if (std::uniform_int_distribution<usize>{ 0, unblocked - 1 }(generator) == 0) {
+					chosen = position;
+				}
+			}
+
+			return chosen;
+		}
+	};
+} // namespace bleak
@@ -2,42 +2,79 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <optional>
 #include <random>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <bleak/applicator.hpp>
+#include <bleak/archive.hpp>
 #include <bleak/array.hpp>
 #include <bleak/atlas.hpp>
+#include <bleak/bitplane.hpp>
 #include <bleak/camera.hpp>
 #include <bleak/cardinal.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/creeper.hpp>
+#include <bleak/delta.hpp>
 #include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
+#include <bleak/line.hpp>
 #include <bleak/log.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/padded_array.hpp>
 #include <bleak/primitive.hpp>
 #include <bleak/sparse.hpp>
+#include <bleak/stencil.hpp>
 #include <bleak/random.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/sightline.hpp>
+#include <bleak/simd.hpp>
+#include <bleak/thread_pool.hpp>
 
 #include <bleak/constants/enums.hpp>
 #include <bleak/constants/numeric.hpp>
 
 namespace bleak {
-	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder = extent_t::Zero> struct region_t;
+	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder = extent_t::Zero, typename Layout = row_major_layout_t> struct region_t;
+
+	// anything read like a zone, by the cell at a position and whether a position lies within a region; the zone itself or a view over a region of zones
+	template<typename Z> concept ZoneLike = requires(cref<Z> zone, offset_t position) {
+		typename Z::value_type;
+		{ Z::zone_size } -> std::convertible_to<extent_t>;
+		{ Z::border_size } -> std::convertible_to<extent_t>;
+		{ zone[position] } -> std::convertible_to<cref<typename Z::value_type>>;
+		{ zone.template within<region_e::All>(position) } -> std::same_as<bool>;
+	};
+
+	// whether a value is compared against the cells of a zone-like as it is; values of the cell type itself are taken by the overloads for it
+	template<typename Z, typename U> struct is_zone_comparable {
+		static constexpr bool value = is_equatable<typename Z::value_type, U>::value && !std::is_same<typename Z::value_type, U>::value;
+	};
 
-	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero> struct zone_t {
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero, typename Layout = row_major_layout_t> struct zone_t {
 		static_assert(Size > extent_t::Zero, "map size must be greater than zero.");
 		static_assert(Size >= BorderSize, "map size must be greater than or equal to border size.");
 
+	  public:
+		using value_type = T;
+
 	  private:
-		array_t<T, Size> cells;
+		array_t<T, Size, Layout> cells;
+
+		// scratch copies share the storage policy of the cells, so a heap-backed zone never places a zone-sized temporary on the stack
+		using padded_type = padded_array_t<T, Size, extent_t{ 1, 1 }, Layout>;
+		using plane_type = bitplane_t<Size, Layout>;
 
 	  public:
 		static constexpr extent_t zone_size{ Size };
@@ -119,7 +156,7 @@ namespace bleak {
 		template<> inline constexpr auto offsets<region_e::Interior>{ interior_offsets };
 		// template<> inline constexpr auto offsets<region_e::Border>{ border_offsets };
 
-		static constexpr usize byte_size{ zone_area * sizeof(T) };
+		static constexpr usize byte_size{ array_t<T, Size, Layout>::byte_size };
 
 		static constexpr bool interior_safe{ border_size.w > 0 && border_size.h > 0 };
 
@@ -143,11 +180,11 @@ namespace bleak {
 			file.close();
 		}
 
-		constexpr zone_t(cref<zone_t<T, Size, BorderSize>> other) : cells{ other.cells } {};
+		constexpr zone_t(cref<zone_t<T, Size, BorderSize, Layout>> other) : cells{ other.cells } {};
 
-		constexpr zone_t(rval<zone_t<T, Size, BorderSize>> other) : cells{ std::move(other.cells) } {}
+		constexpr zone_t(rval<zone_t<T, Size, BorderSize, Layout>> other) : cells{ std::move(other.cells) } {}
 
-		constexpr ref<zone_t<T, Size, BorderSize>> operator=(cref<zone_t<T, Size, BorderSize>> other) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> operator=(cref<zone_t<T, Size, BorderSize, Layout>> other) noexcept {
 			if (this != &other) {
 				cells = other.cells;
 			}
@@ -155,7 +192,7 @@ namespace bleak {
 			return *this;
 		}
 
-		constexpr ref<zone_t<T, Size, BorderSize>> operator=(rval<zone_t<T, Size, BorderSize>> other) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> operator=(rval<zone_t<T, Size, BorderSize, Layout>> other) noexcept {
 			if (this != &other) {
 				cells = std::move(other.cells);
 			}
@@ -165,9 +202,11 @@ namespace bleak {
 
 		constexpr ~zone_t() noexcept {}
 
-		constexpr cref<array_t<T, Size>> data() const noexcept { return cells; }
+		constexpr zone_t<T, Size, BorderSize, Layout> clone() const noexcept { return zone_t<T, Size, BorderSize, Layout>{ *this }; }
 
-		constexpr cptr<array_t<T, Size>> data_ptr() const noexcept { return &cells; }
+		constexpr cref<array_t<T, Size, Layout>> data() const noexcept { return cells; }
+
+		constexpr cptr<array_t<T, Size, Layout>> data_ptr() const noexcept { return &cells; }
 
 		constexpr array_t<cref<T>, Size> view() const {
 			array_t<cref<T>, Size> view{};
@@ -211,29 +250,29 @@ namespace bleak {
 
 		constexpr cref<T> operator[](offset_t position) const noexcept { return cells[position]; }
 
-		constexpr array_t<T, Size>::iterator begin() noexcept { return cells.begin(); }
+		constexpr array_t<T, Size, Layout>::iterator begin() noexcept { return cells.begin(); }
 
-		constexpr array_t<T, Size>::const_iterator begin() const noexcept { return cells.begin(); }
+		constexpr array_t<T, Size, Layout>::const_iterator begin() const noexcept { return cells.begin(); }
 
-		constexpr array_t<T, Size>::iterator end() noexcept { return cells.end(); }
+		constexpr array_t<T, Size, Layout>::iterator end() noexcept { return cells.end(); }
 
-		constexpr array_t<T, Size>::const_iterator end() const noexcept { return cells.end(); }
+		constexpr array_t<T, Size, Layout>::const_iterator end() const noexcept { return cells.end(); }
 
-		constexpr array_t<T, Size>::const_iterator cbegin() const noexcept { return cells.cbegin(); }
+		constexpr array_t<T, Size, Layout>::const_iterator cbegin() const noexcept { return cells.cbegin(); }
 
-		constexpr array_t<T, Size>::const_iterator cend() const noexcept { return cells.cend(); }
+		constexpr array_t<T, Size, Layout>::const_iterator cend() const noexcept { return cells.cend(); }
 
-		constexpr array_t<T, Size>::reverse_iterator rbegin() noexcept { return cells.rbegin(); }
+		constexpr array_t<T, Size, Layout>::reverse_iterator rbegin() noexcept { return cells.rbegin(); }
 
-		constexpr array_t<T, Size>::reverse_iterator rend() noexcept { return cells.rend(); }
+		constexpr array_t<T, Size, Layout>::reverse_iterator rend() noexcept { return cells.rend(); }
 
-		constexpr array_t<T, Size>::const_reverse_iterator rbegin() const noexcept { return cells.rbegin(); }
+		constexpr array_t<T, Size, Layout>::const_reverse_iterator rbegin() const noexcept { return cells.rbegin(); }
 
-		constexpr array_t<T, Size>::const_reverse_iterator rend() const noexcept { return cells.rend(); }
+		constexpr array_t<T, Size, Layout>::const_reverse_iterator rend() const noexcept { return cells.rend(); }
 
-		constexpr array_t<T, Size>::const_reverse_iterator crbegin() const noexcept { return cells.crbegin(); }
+		constexpr array_t<T, Size, Layout>::const_reverse_iterator crbegin() const noexcept { return cells.crbegin(); }
 
-		constexpr array_t<T, Size>::const_reverse_iterator crend() const noexcept { return cells.crend(); }
+		constexpr array_t<T, Size, Layout>::const_reverse_iterator crend() const noexcept { return cells.crend(); }
 
 		constexpr bool on_x_edge(offset_t position) const noexcept { return position.x == zone_origin.x || position.x == zone_extent.x; }
 
@@ -275,7 +314,7 @@ namespace bleak {
 			return false;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> set(cref<T> value) noexcept {
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> set(cref<T> value) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					cells[i] = value;
@@ -306,7 +345,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> set(cref<U> value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> set(cref<U> value) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					cells[i] = value;
@@ -335,7 +374,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> reset() noexcept {
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> reset() noexcept {
 			set<Region>(T{});
 
 			return *this;
@@ -343,7 +382,7 @@ namespace bleak {
 
 		template<region_e Region>
 			requires is_operable_unary<T, operator_e::Addition>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> apply(cref<T> value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> apply(cref<T> value) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					cells[i] += value;
@@ -374,7 +413,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires is_operable<T, U, operator_e::Addition>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> apply(cref<U> value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> apply(cref<U> value) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					assert(i < zone_area);
@@ -406,7 +445,7 @@ namespace bleak {
 
 		template<region_e Region, typename... Params>
 			requires(is_operable<T, Params, operator_e::Addition>::value, ...) && is_plurary<Params...>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> apply(cref<Params>... values) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> apply(cref<Params>... values) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					for (auto value : { values... }) {
@@ -445,7 +484,7 @@ namespace bleak {
 
 		template<region_e Region>
 			requires is_operable_unary<T, operator_e::Subtraction>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> repeal(cref<T> value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> repeal(cref<T> value) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					cells[i] -= value;
@@ -476,7 +515,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires is_operable<T, U, operator_e::Subtraction>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> repeal(cref<U> value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> repeal(cref<U> value) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					cells[i] -= value;
@@ -507,7 +546,7 @@ namespace bleak {
 
 		template<region_e Region, typename... Params>
 			requires(is_operable<T, Params, operator_e::Subtraction>::value, ...) && is_plurary<Params...>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> repeal(cref<Params>... values) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> repeal(cref<Params>... values) noexcept {
 			if constexpr (Region == region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 					for (auto value : { values... }) {
@@ -544,9 +583,9 @@ namespace bleak {
 			return *this;
 		}
 
-		constexpr void swap(ref<array_t<T, Size>> buffer) noexcept { std::swap(cells, buffer); }
+		constexpr void swap(ref<array_t<T, Size, Layout>> buffer) noexcept { std::swap(cells, buffer); }
 
-		constexpr void sync(cref<array_t<T, Size>> buffer) noexcept {
+		constexpr void sync(cref<array_t<T, Size, Layout>> buffer) noexcept {
 			for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 				cells[i] = buffer[i];
 			}
@@ -562,7 +601,7 @@ namespace bleak {
 
 		template<region_e Region, typename U, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -597,7 +636,7 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<T> true_value, cref<T> false_value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<T> true_value, cref<T> false_value) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -634,7 +673,7 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<U> true_value, cref<U> false_value) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<U> true_value, cref<U> false_value) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -671,7 +710,7 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<T>> applicator) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -708,7 +747,7 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<U>> applicator) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -745,7 +784,7 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<T>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<T>> applicator, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -784,7 +823,7 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> randomize(ref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1177,7 +1216,113 @@ namespace bleak {
 			return index;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> spoke(cref<T> value, cref<sparse_t<bool>> spokes) noexcept {
+		// evaluates calculate_index for every cell in a single sweep; off-edge neighbours read the value from a ghost ring rather than being bounds checked
+		template<solver_e Solver, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		constexpr cref<zone_t<T, Size, BorderSize, Layout>> calculate_indices(ref<zone_t<u8, Size, BorderSize>> indices, cref<U> value) const noexcept {
+			T sentinel{};
+			sentinel = value;
+
+			const padded_type source{ cells, sentinel };
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				cptr<T> north{ &source[0, y - 1] };
+				cptr<T> row{ &source[0, y] };
+				cptr<T> south{ &source[0, y + 1] };
+
+				ptr<u8> target{ &indices[0, y] };
+
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					if constexpr (Solver == solver_e::Melded) {
+						const bool nw{ north[x - 1] == value };
+						const bool n{ north[x] == value };
+						const bool ne{ north[x + 1] == value };
+
+						const bool w{ row[x - 1] == value };
+						const bool e{ row[x + 1] == value };
+
+						const bool sw{ south[x - 1] == value };
+						const bool s{ south[x] == value };
+						const bool se{ south[x + 1] == value };
+
+						target[x] = static_cast<u8>(((nw & n & w) << 3) | ((n & ne & e) << 2) | ((e & se & s) << 1) | (w & sw & s));
+					} else if constexpr (Solver == solver_e::MarchingSquares) {
+						target[x] = static_cast<u8>(((row[x] == value) << 3) | ((row[x + 1] == value) << 2) | ((south[x + 1] == value) << 1) | (south[x] == value));
+					} else {
+						target[x] = 0;
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		// refreshes the indices of the three-by-three neighbourhood around a written cell, which covers every cell whose index can read it
+		template<solver_e Solver, typename U>
+			requires is_equatable<T, U>::value
+		constexpr cref<zone_t<T, Size, BorderSize, Layout>> recalculate_indices(ref<zone_t<u8, Size, BorderSize>> indices, cref<U> value, offset_t position) const noexcept {
+			for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
+				for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
+					const offset_t current_position{ position + offset_t{ x, y } };
+
+					if (!within<region_e::All>(current_position)) {
+						continue;
+					}
+
+					indices[current_position] = calculate_index<Solver>(current_position, value);
+				}
+			}
+
+			return *this;
+		}
+
+		template<solver_e Solver, typename U>
+			requires is_equatable<T, U>::value
+		constexpr cref<zone_t<T, Size, BorderSize, Layout>> recalculate_indices(ref<zone_t<u8, Size, BorderSize>> indices, cref<U> value, cref<std::vector<offset_t>> positions) const noexcept {
+			for (cauto position : positions) {
+				recalculate_indices<Solver>(indices, value, position);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution, CounterBasedEngine Randomizer>
+			requires is_counter_based_engine<Randomizer>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> randomize(cref<Randomizer> generator, f64 fill_percent, cref<T> true_value, cref<T> false_value) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { randomize_rows<Region>(generator, begin, end, fill_percent, true_value, false_value); });
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution, CounterBasedEngine Randomizer, typename U>
+			requires is_counter_based_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> randomize(cref<Randomizer> generator, f64 fill_percent, cref<U> true_value, cref<U> false_value) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { randomize_rows<Region>(generator, begin, end, fill_percent, true_value, false_value); });
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution, CounterBasedEngine Randomizer>
+			requires is_counter_based_engine<Randomizer>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> randomize(cref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<T>> applicator) noexcept {
+			return randomize<Region, Execution>(generator, fill_percent, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution, CounterBasedEngine Randomizer, typename U>
+			requires is_counter_based_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> randomize(cref<Randomizer> generator, f64 fill_percent, cref<binary_applicator_t<U>> applicator) noexcept {
+			return randomize<Region, Execution>(generator, fill_percent, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> spoke(cref<T> value, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1196,7 +1341,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> spoke(cref<U> value, cref<sparse_t<bool>> spokes) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> spoke(cref<U> value, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1212,7 +1357,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region> constexpr cref<zone_t<T, Size, BorderSize>> spoke(ref<array_t<T, Size>> buffer, cref<T> value, cref<sparse_t<bool>> spokes) const noexcept {
+		template<region_e Region> constexpr cref<zone_t<T, Size, BorderSize, Layout>> spoke(ref<array_t<T, Size, Layout>> buffer, cref<T> value, cref<sparse_t<bool>> spokes) const noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1231,7 +1376,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
-		constexpr cref<zone_t<T, Size, BorderSize>> spoke(ref<array_t<T, Size>> buffer, cref<U> value, cref<sparse_t<bool>> spokes) const noexcept {
+		constexpr cref<zone_t<T, Size, BorderSize, Layout>> spoke(ref<array_t<T, Size, Layout>> buffer, cref<U> value, cref<sparse_t<bool>> spokes) const noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1247,71 +1392,44 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> collapse(cref<T> value, usize index, cref<T> collapse_to) noexcept {
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> collapse(cref<T> value, usize index, cref<T> collapse_to) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			array_t<T, Size> buffer{ cells };
+			plane_type collapsed{};
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
+			collapse_rows<Region>(zone_origin.y, zone_size.h, value, index, [&](offset_t position) { collapsed.set(position); });
 
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
+			fill_marked(collapsed, collapse_to);
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
-							continue;
-						}
+			return *this;
+		}
 
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
+		template<region_e Region, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> collapse(cref<U> value, usize index, cref<U> collapse_to) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
+			plane_type collapsed{};
 
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
+			collapse_rows<Region>(zone_origin.y, zone_size.h, value, index, [&](offset_t position) { collapsed.set(position); });
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
+			fill_marked(collapsed, collapse_to);
 
-							buffer[inner_position] = collapse_to;
+			return *this;
+		}
 
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> collapse(ref<array_t<T, Size, Layout>> buffer, cref<T> value, usize index, cref<T> collapse_to) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
+			buffer = cells;
 
-							buffer[outer_position] = collapse_to;
-						}
-					}
-				}
-			}
+			collapse_rows<Region>(zone_origin.y, zone_size.h, value, index, [&](offset_t position) { buffer[position] = collapse_to; });
 
 			swap(buffer);
 
@@ -1320,183 +1438,321 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> collapse(cref<U> value, usize index, cref<U> collapse_to) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> collapse(ref<array_t<T, Size, Layout>> buffer, cref<U> value, usize index, cref<U> collapse_to) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			array_t<T, Size> buffer{ cells };
-
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
+			buffer = cells;
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
+			collapse_rows<Region>(zone_origin.y, zone_size.h, value, index, [&](offset_t position) { buffer[position] = collapse_to; });
 
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
+			swap(buffer);
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
-							continue;
-						}
+			return *this;
+		}
 
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
+		template<region_e Region, execution_e Execution, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> collapse(cref<U> value, usize index, cref<U> collapse_to) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
+			plane_type collapsed{};
 
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { collapse_rows<Region>(begin, end, value, index, [&](offset_t position) { collapsed.set(position); }); });
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
+			fill_marked(collapsed, collapse_to);
 
-							buffer[inner_position] = collapse_to;
+			return *this;
+		}
 
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
+		template<region_e Region, execution_e Execution, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> collapse(ref<array_t<T, Size, Layout>> buffer, cref<U> value, usize index, cref<U> collapse_to) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
+			buffer = cells;
 
-							buffer[outer_position] = collapse_to;
-						}
-					}
-				}
-			}
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { collapse_rows<Region>(begin, end, value, index, [&](offset_t position) { buffer[position] = collapse_to; }); });
 
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> collapse(ref<array_t<T, Size>> buffer, cref<T> value, usize index, cref<T> collapse_to) noexcept {
+		// copies the cells of the region into the target, such as to bring the untouched cells of a back buffer up to date
+		template<region_e Region, execution_e Execution = execution_e::Sequential> inline void copy_into(ref<zone_t<T, Size, BorderSize, Layout>> target) const noexcept {
 			if constexpr (Region == region_e::None) {
-				return *this;
+				return;
 			}
 
-			buffer = cells;
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { copy_rows<Region>(target.cells, begin, end); });
+		}
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
+		// automatize with another zone as the buffer; tied cells keep the value the target already holds, just as automatize leaves them to its buffer
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline void automatize_into(ref<zone_t<T, Size, BorderSize, Layout>> target, u8 threshold, cref<U> true_state, cref<U> false_state) const noexcept {
+			if constexpr (Region == region_e::None) {
+				return;
+			}
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { modulate_rows<Region>(target.cells, begin, end, threshold, true_state, false_state); });
+		}
 
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires std::is_assignable<T, U>::value
+		inline void automatize_into(ref<zone_t<T, Size, BorderSize, Layout>> target, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
+			automatize_into<Region, Execution>(target, threshold, applicator.true_value, applicator.false_value);
+		}
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
-							continue;
-						}
+		// writes every cell of the region into the target with uncollapsed cells keeping their current value
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline void collapse_into(ref<zone_t<T, Size, BorderSize, Layout>> target, cref<U> value, usize index, cref<U> collapse_to) const noexcept {
+			if constexpr (Region == region_e::None) {
+				return;
+			}
 
-						buffer[position] = collapse_to;
-					}
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
+					copy_rows<Region>(target.cells, y, extent_t::scalar_cast(y + 1));
+					collapse_rows<Region>(y, extent_t::scalar_cast(y + 1), value, index, [&](offset_t position) { target.cells[position] = collapse_to; });
 				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
+			});
+		}
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
+		// fuses the stages into a single in-place traversal over a sliding window of rows, so the zone is streamed through memory once however many stages there are
+		template<region_e Region, typename... Stages>
+			requires (sizeof...(Stages) > 0)
+		inline ref<zone_t<T, Size, BorderSize, Layout>> pipeline(cref<Stages>... stages) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
 
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
+			stencil_pipeline_t<T, Size, Stages...> stencil{ stages... };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
+			const auto covers{ [&](offset_t position) -> bool { return within<Region>(position); } };
 
-							buffer[inner_position] = collapse_to;
+			if constexpr (Layout::contiguous_rows) {
+				const auto sink{ [&](extent_t::scalar_t y, cptr<T> row) {
+					if (row != &cells[0, y]) {
+						std::copy_n(row, static_cast<usize>(zone_size.w), &cells[0, y]);
+					}
+				} };
 
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					stencil.template push<0>(y, &cells[0, y], covers, sink);
+				}
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
+				stencil.template finish<0>(covers, sink);
+			} else {
+				std::vector<T> row(static_cast<usize>(zone_size.w));
 
-							buffer[outer_position] = collapse_to;
-						}
+				const auto sink{ [&](extent_t::scalar_t y, cptr<T> output) {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						cells[x, y] = output[x];
+					}
+				} };
+
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						row[x] = cells[x, y];
 					}
+
+					stencil.template push<0>(y, row.data(), covers, sink);
 				}
-			}
 
-			swap(buffer);
+				stencil.template finish<0>(covers, sink);
+			}
 
 			return *this;
 		}
 
-		template<region_e Region, typename U>
-			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> collapse(ref<array_t<T, Size>> buffer, cref<U> value, usize index, cref<U> collapse_to) noexcept {
-			if constexpr (Region == region_e::None) {
-				return *this;
+		template<bool Safe = false> constexpr void modulate(ref<array_t<T, Size, Layout>> buffer, offset_t position, u8 threshold, cref<T> true_state, cref<T> false_state) const noexcept {
+			u8 neighbours{ neighbour_count<Safe>(position, true_state) };
+
+			if (neighbours > threshold) {
+				buffer[position] = true_state;
+			} else if (neighbours < threshold) {
+				buffer[position] = false_state;
 			}
+		}
 
-			buffer = cells;
+		template<bool Safe = false, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr void modulate(ref<array_t<T, Size, Layout>> buffer, offset_t position, u8 threshold, cref<U> true_state, cref<U> false_state) const noexcept {
+			u8 neighbours{ neighbour_count<Safe>(position, true_state) };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
+			if (neighbours > threshold) {
+				buffer[position] = true_state;
+			} else if (neighbours < threshold) {
+				buffer[position] = false_state;
+			}
+		}
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
+		template<bool Safe = false> constexpr void modulate(ref<array_t<T, Size, Layout>> buffer, offset_t position, u8 threshold, cref<binary_applicator_t<T>> applicator) const noexcept {
+			u8 neighbours{ neighbour_count<Safe>(position, applicator.true_value) };
 
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+			if (neighbours > threshold) {
+				buffer[position] = applicator.true_value;
+			} else if (neighbours < threshold) {
+				buffer[position] = applicator.false_value;
+			}
+		}
+
+		template<bool Safe = false, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr void modulate(ref<array_t<T, Size, Layout>> buffer, offset_t position, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
+			u8 neighbours{ neighbour_count<Safe>(position, applicator.true_value) };
+
+			if (neighbours > threshold) {
+				buffer[position] = applicator.true_value;
+			} else if (neighbours < threshold) {
+				buffer[position] = applicator.false_value;
+			}
+		}
+
+	  private:
+		static constexpr bool byte_cells{ sizeof(T) == 1 && (std::is_integral<T>::value || std::is_enum<T>::value) && Layout::contiguous_rows };
+
+		// the byte kernel compares raw cells, so a value of another type may only take it if it survives conversion to the cell type unchanged
+		template<typename U> static constexpr bool byte_representable(cref<U> value) noexcept { return static_cast<T>(value) == value; }
+
+		// only rows within [begin, end) are modulated
+		constexpr void modulate_interior(ref<array_t<T, Size, Layout>> buffer, extent_t::scalar_t begin, extent_t::scalar_t end, u8 threshold, cref<T> true_state, cref<T> false_state) const noexcept {
+			const extent_t::scalar_t first_row{ max(interior_origin.y, begin) };
+			const extent_t::scalar_t last_row{ min(min(interior_extent.y, zone_extent.y), extent_t::scalar_cast(end - 1)) };
+
+			constexpr extent_t::scalar_t first_column{ interior_origin.x };
+			constexpr extent_t::scalar_t last_column{ min(interior_extent.x, zone_extent.x) };
+
+			// the vectorized span must keep every neighbour within the zone
+			constexpr extent_t::scalar_t span_first{ max(first_column, extent_t::scalar_t{ 1 }) };
+			constexpr extent_t::scalar_t span_last{ min(last_column, extent_t::scalar_cast(zone_extent.x - 1)) };
+
+			cptr<u8> source{ reinterpret_cast<cptr<u8>>(cells.data_ptr()) };
+			ptr<u8> target{ reinterpret_cast<ptr<u8>>(buffer.data_ptr()) };
+
+			const u8 true_byte{ std::bit_cast<u8>(true_state) };
+			const u8 false_byte{ std::bit_cast<u8>(false_state) };
+
+			for (extent_t::scalar_t y{ first_row }; y <= last_row; ++y) {
+				if (y < 1 || y >= zone_extent.y || span_first > span_last) {
+					for (extent_t::scalar_t x{ first_column }; x <= last_column; ++x) {
+						modulate(buffer, offset_t{ x, y }, threshold, true_state, false_state);
+					}
+
+					continue;
+				}
+
+				for (extent_t::scalar_t x{ first_column }; x < span_first; ++x) {
+					modulate(buffer, offset_t{ x, y }, threshold, true_state, false_state);
+				}
+
+				const usize row{ array_t<T, Size, Layout>::flatten(span_first, y) };
+				const usize stride{ static_cast<usize>(zone_size.w) };
+
+				simd::modulate_row(source + row - stride, source + row, source + row + stride, target + row, static_cast<usize>(span_last - span_first + 1), threshold, true_byte, false_byte);
+
+				for (extent_t::scalar_t x{ extent_t::scalar_cast(span_last + 1) }; x <= last_column; ++x) {
+					modulate(buffer, offset_t{ x, y }, threshold, true_state, false_state);
+				}
+			}
+		}
+
+		// row-banded equivalent of a single automatize step; only rows within [begin, end) of the buffer are written
+		template<region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr void modulate_rows(ref<array_t<T, Size, Layout>> buffer, extent_t::scalar_t begin, extent_t::scalar_t end, u8 threshold, cref<U> true_state, cref<U> false_state) const noexcept {
+			if constexpr (Region == region_e::All) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
+						modulate(buffer, offset_t{ x, y }, threshold, true_state, false_state);
+					}
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				if constexpr (byte_cells && std::is_convertible<U, T>::value) {
+					if (byte_representable(true_state) && byte_representable(false_state)) {
+						modulate_interior(buffer, begin, end, threshold, static_cast<T>(true_state), static_cast<T>(false_state));
+						return;
+					}
+				}
+
+				for (extent_t::scalar_t y{ max(interior_origin.y, begin) }; y <= min(interior_extent.y, extent_t::scalar_cast(end - 1)); ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_state, false_state);
+					}
+				}
+			} else if constexpr (Region == region_e::Border) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+							modulate(buffer, offset_t{ x, y }, threshold, true_state, false_state);
+						}
+					} else {
+						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
+							modulate(buffer, offset_t{ i, y }, threshold, true_state, false_state);
+							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, true_state, false_state);
+						}
+					}
+				}
+			}
+		}
+
+		// writes the value into every marked cell, skipping whole words of the plane without a mark
+		template<typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr void fill_marked(cref<plane_type> marks, cref<U> value) noexcept {
+			cptr<u64> words{ marks.data_ptr() };
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (usize i{ 0 }; i < plane_type::stride; ++i) {
+					u64 word{ words[static_cast<usize>(y) * plane_type::stride + i] };
+
+					while (word != 0) {
+						cells[extent_t::scalar_cast(i * 64 + static_cast<usize>(std::countr_zero(word))), y] = value;
+
+						word &= word - 1;
+					}
+				}
+			}
+		}
+
+		// row-banded equivalent of a single collapse step; every cell within rows [begin, end) that would collapse is handed to the callback
+		template<region_e Region, typename U, typename Collapse>
+			requires is_equatable<T, U>::value
+		constexpr void collapse_rows(extent_t::scalar_t begin, extent_t::scalar_t end, cref<U> value, usize index, rval<Collapse> collapse) const noexcept {
+			if constexpr (Region == region_e::All) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, U, interior_safe>(position, value) != index) {
+						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
 							continue;
 						}
 
-						buffer[position] = collapse_to;
+						collapse(position);
+					}
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				for (extent_t::scalar_t y{ max(interior_origin.y, begin) }; y <= min(interior_extent.y, extent_t::scalar_cast(end - 1)); ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+						const offset_t position{ x, y };
+
+						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
+							continue;
+						}
+
+						collapse(position);
 					}
 				}
 			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
 					if (y < interior_origin.y || y > interior_extent.y) {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
 							const offset_t position{ x, y };
@@ -1505,81 +1761,88 @@ namespace bleak {
 								continue;
 							}
 
-							buffer[position] = collapse_to;
+							collapse(position);
 						}
 					} else {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
 							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
+							if (cells[inner_position] == value && calculate_index<solver_e::Melded>(inner_position, value) == index) {
+								collapse(inner_position);
 							}
 
-							buffer[inner_position] = collapse_to;
-
-						outer_pos:
 							const offset_t outer_position{ zone_extent.x - i, y };
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
+							if (cells[outer_position] == value && calculate_index<solver_e::Melded>(outer_position, value) == index) {
+								collapse(outer_position);
 							}
-
-							buffer[outer_position] = collapse_to;
 						}
 					}
 				}
 			}
-
-			swap(buffer);
-
-			return *this;
 		}
 
-		template<bool Safe = false> constexpr void modulate(ref<array_t<T, Size>> buffer, offset_t position, u8 threshold, cref<T> true_state, cref<T> false_state) const noexcept {
-			u8 neighbours{ neighbour_count<Safe>(position, true_state) };
-
-			if (neighbours > threshold) {
-				buffer[position] = true_state;
-			} else if (neighbours < threshold) {
-				buffer[position] = false_state;
+		// visits the region within rows [begin, end) as inclusive spans of columns, one or two per row
+		template<region_e Region, typename Visitor> static constexpr void spans(extent_t::scalar_t begin, extent_t::scalar_t end, rval<Visitor> visitor) noexcept {
+			if constexpr (Region == region_e::All) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
+					visitor(zone_origin.x, zone_extent.x, y);
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				for (extent_t::scalar_t y{ max(interior_origin.y, begin) }; y <= min(min(interior_extent.y, zone_extent.y), extent_t::scalar_cast(end - 1)); ++y) {
+					visitor(interior_origin.x, min(interior_extent.x, zone_extent.x), y);
+				}
+			} else if constexpr (Region == region_e::Border) {
+				for (extent_t::scalar_t y{ begin }; y < end; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						visitor(zone_origin.x, zone_extent.x, y);
+					} else if constexpr (border_size.w > 0) {
+						visitor(zone_origin.x, extent_t::scalar_cast(border_size.w - 1), y);
+						visitor(extent_t::scalar_cast(zone_extent.x - border_size.w + 1), zone_extent.x, y);
+					}
+				}
 			}
 		}
 
-		template<bool Safe = false, typename U>
-			requires std::is_assignable<T, U>::value
-		constexpr void modulate(ref<array_t<T, Size>> buffer, offset_t position, u8 threshold, cref<U> true_state, cref<U> false_state) const noexcept {
-			u8 neighbours{ neighbour_count<Safe>(position, true_state) };
-
-			if (neighbours > threshold) {
-				buffer[position] = true_state;
-			} else if (neighbours < threshold) {
-				buffer[position] = false_state;
-			}
+		// copies the cells of the region within rows [begin, end) into the buffer
+		template<region_e Region> constexpr void copy_rows(ref<array_t<T, Size, Layout>> buffer, extent_t::scalar_t begin, extent_t::scalar_t end) const noexcept {
+			spans<Region>(begin, end, [&](extent_t::scalar_t first, extent_t::scalar_t last, extent_t::scalar_t y) {
+				if constexpr (Layout::contiguous_rows) {
+					std::copy_n(&cells[first, y], static_cast<usize>(last - first + 1), &buffer[first, y]);
+				} else {
+					for (extent_t::scalar_t x{ first }; x <= last; ++x) {
+						buffer[x, y] = cells[x, y];
+					}
+				}
+			});
 		}
 
-		template<bool Safe = false> constexpr void modulate(ref<array_t<T, Size>> buffer, offset_t position, u8 threshold, cref<binary_applicator_t<T>> applicator) const noexcept {
-			u8 neighbours{ neighbour_count<Safe>(position, applicator.true_value) };
+		// each cell draws from the generator at its own coordinates, so the result is independent of traversal order and banding
+		template<region_e Region, CounterBasedEngine Randomizer, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr void randomize_rows(cref<Randomizer> generator, extent_t::scalar_t begin, extent_t::scalar_t end, f64 fill_percent, cref<U> true_value, cref<U> false_value) noexcept {
+			const u64 threshold{ Randomizer::threshold(fill_percent) };
 
-			if (neighbours > threshold) {
-				buffer[position] = applicator.true_value;
-			} else if (neighbours < threshold) {
-				buffer[position] = applicator.false_value;
-			}
+			spans<Region>(begin, end, [&](extent_t::scalar_t first, extent_t::scalar_t last, extent_t::scalar_t y) {
+				for (extent_t::scalar_t x{ first }; x <= last; ++x) {
+					cells[x, y] = Randomizer::below(generator.at(static_cast<u32>(x), static_cast<u32>(y)), threshold) ? true_value : false_value;
+				}
+			});
 		}
 
-		template<bool Safe = false, typename U>
-			requires std::is_assignable<T, U>::value
-		constexpr void modulate(ref<array_t<T, Size>> buffer, offset_t position, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
-			u8 neighbours{ neighbour_count<Safe>(position, applicator.true_value) };
-
-			if (neighbours > threshold) {
-				buffer[position] = applicator.true_value;
-			} else if (neighbours < threshold) {
-				buffer[position] = applicator.false_value;
+		template<execution_e Execution, typename Task> static inline void banded(rval<Task> callback) noexcept {
+			if constexpr (Execution == execution_e::Parallel) {
+				thread_pool_t::instance().partition(static_cast<usize>(zone_size.h), [&](usize begin, usize end) {
+					callback(extent_t::scalar_cast(begin), extent_t::scalar_cast(end));
+				});
+			} else {
+				callback(zone_origin.y, zone_size.h);
 			}
 		}
 
-		template<region_e Region> constexpr cref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u8 threshold, cref<T> true_value, cref<T> false_state) const noexcept {
+	  public:
+
+		template<region_e Region> constexpr cref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u8 threshold, cref<T> true_value, cref<T> false_state) const noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1591,9 +1854,13 @@ namespace bleak {
 					}
 				}
 			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
+				if constexpr (byte_cells) {
+					modulate_interior(buffer, zone_origin.y, zone_size.h, threshold, true_value, false_state);
+				} else {
+					for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+						for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+							modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
+						}
 					}
 				}
 			} else if constexpr (Region == region_e::Border) {
@@ -1616,7 +1883,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires std::is_assignable<T, U>::value
-		constexpr cref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u8 threshold, cref<U> true_value, cref<U> false_state) const noexcept {
+		constexpr cref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u8 threshold, cref<U> true_value, cref<U> false_state) const noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1628,11 +1895,7 @@ namespace bleak {
 					}
 				}
 			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-					}
-				}
+				modulate_rows<Region>(buffer, zone_origin.y, zone_size.h, threshold, true_value, false_state);
 			} else if constexpr (Region == region_e::Border) {
 				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
 					if (y < interior_origin.y || y > interior_extent.y) {
@@ -1651,70 +1914,603 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region> constexpr cref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u8 threshold, cref<binary_applicator_t<T>> applicator) const noexcept {
+		template<region_e Region> constexpr cref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u8 threshold, cref<binary_applicator_t<T>> applicator) const noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			if constexpr (Region == region_e::All) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
+						modulate(buffer, offset_t{ x, y }, threshold, applicator);
+					}
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				if constexpr (byte_cells) {
+					modulate_interior(buffer, zone_origin.y, zone_size.h, threshold, applicator.true_value, applicator.false_value);
+				} else {
+					for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+						for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+							modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, applicator);
+						}
+					}
+				}
+			} else if constexpr (Region == region_e::Border) {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+							modulate(buffer, offset_t{ x, y }, threshold, applicator);
+						}
+					} else {
+						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
+							modulate(buffer, offset_t{ i, y }, threshold, applicator);
+							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, applicator);
+						}
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr cref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			if constexpr (Region == region_e::All) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
+						modulate(buffer, offset_t{ x, y }, threshold, applicator);
+					}
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				modulate_rows<Region>(buffer, zone_origin.y, zone_size.h, threshold, applicator.true_value, applicator.false_value);
+			} else if constexpr (Region == region_e::Border) {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+							modulate(buffer, offset_t{ x, y }, threshold, applicator);
+						}
+					} else {
+						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
+							modulate(buffer, offset_t{ i, y }, threshold, applicator);
+							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, applicator);
+						}
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize<Region>(buffer, threshold, true_value, false_state);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize<Region>(buffer, threshold, true_value, false_state);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize<Region>(buffer, threshold, applicator);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize<Region>(buffer, threshold, applicator);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				spoke<Region>(buffer, applicator.false_value, spokes);
+				automatize<Region>(buffer, threshold, applicator);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				spoke<Region>(buffer, applicator.false_value, spokes);
+				automatize<Region>(buffer, threshold, applicator);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution, typename U>
+			requires std::is_assignable<T, U>::value
+		inline cref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u8 threshold, cref<U> true_value, cref<U> false_state) const noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { modulate_rows<Region>(buffer, begin, end, threshold, true_value, false_state); });
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution, typename U>
+			requires std::is_assignable<T, U>::value
+		inline cref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
+			return automatize<Region, Execution>(buffer, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize<Region, Execution>(buffer, threshold, true_value, false_state);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize<Region, Execution>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> automatize(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				spoke<Region>(buffer, applicator.false_value, spokes);
+				automatize<Region, Execution>(buffer, threshold, applicator.true_value, applicator.false_value);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+	  private:
+		template<region_e Region> static constexpr plane_type region_mask() noexcept {
+			plane_type mask{};
+
+			if constexpr (Region == region_e::All) {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						mask.set(offset_t{ x, y });
+					}
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				for (extent_t::scalar_t y{ interior_origin.y }; y <= min(interior_extent.y, zone_extent.y); ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= min(interior_extent.x, zone_extent.x); ++x) {
+						mask.set(offset_t{ x, y });
+					}
+				}
+			} else if constexpr (Region == region_e::Border) {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+							mask.set(offset_t{ x, y });
+						}
+					} else {
+						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
+							mask.set(offset_t{ i, y });
+							mask.set(offset_t{ zone_extent.x - i, y });
+						}
+					}
+				}
+			}
+
+			return mask;
+		}
+
+		template<region_e Region> constexpr plane_type spoke_mask(cref<sparse_t<bool>> spokes) const noexcept {
+			plane_type mask{};
+
+			if (!within<Region>(zone_center)) {
+				return mask;
+			}
+
+			for (cauto [position, _] : spokes) {
+				if (!within<Region>(position) || !within<region_e::All>(position)) {
+					continue;
+				}
+
+				if (position == zone_center) {
+					mask.set(zone_center);
+
+					continue;
+				}
+
+				offset_t delta{ std::abs(position.x - zone_center.x), std::abs(position.y - zone_center.y) };
+
+				offset_t step{ zone_center.x < position.x ? 1 : -1, zone_center.y < position.y ? 1 : -1 };
+
+				i32 err = delta.x - delta.y;
+
+				offset_t current_position{ zone_center };
+
+				for (;;) {
+					i32 e2 = 2 * err;
+
+					if (e2 > -delta.y) {
+						err -= delta.y;
+						current_position.x += step.x;
+					}
+
+					if (e2 < delta.x) {
+						err += delta.x;
+						current_position.y += step.y;
+					}
+
+					if (!within<Region>(current_position)) {
+						break;
+					}
+
+					mask.set(current_position);
+
+					if (current_position == position) {
+						break;
+					}
+				}
+			}
+
+			return mask;
+		}
+
+		template<typename U> static constexpr void pack(ref<plane_type> plane, cref<array_t<T, Size, Layout>> source, cref<U> value) noexcept {
+			plane.clear();
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					if (source[x, y] == value) {
+						plane.set(offset_t{ x, y });
+					}
+				}
+			}
+		}
+
+		template<typename U> static constexpr void unpack(cref<plane_type> plane, ref<array_t<T, Size, Layout>> target, cref<plane_type> mask, cref<U> true_value, cref<U> false_value) noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					const offset_t position{ x, y };
+
+					if (!mask.test(position)) {
+						continue;
+					}
+
+					target[position] = plane.test(position) ? true_value : false_value;
+				}
+			}
+		}
+
+		template<execution_e Execution> static inline void step_packed(cref<plane_type> source, ref<plane_type> target, cref<plane_type> mask, u8 threshold) noexcept {
+			banded<Execution>([&](extent_t::scalar_t begin, extent_t::scalar_t end) { plane_type::automatize(source, target, mask, threshold, begin, end); });
+		}
+
+		// automatize_packed for generate, which needs no buffer as both planes start out packed from the cells; the zone is left holding the back plane, just as generate has always swapped its buffer back in after automatizing
+		template<region_e Region, execution_e Execution, typename U> inline void generate_packed(u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if (iterations == 0) {
+				return;
+			}
+
+			const plane_type mask{ region_mask<Region>() };
+
+			plane_type front_plane{};
+
+			pack(front_plane, cells, true_value);
+
+			plane_type back_plane{ front_plane };
+
+			ptr<plane_type> front{ &front_plane };
+			ptr<plane_type> back{ &back_plane };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				step_packed<Execution>(*front, *back, mask, threshold);
+				std::swap(front, back);
+			}
+
+			unpack(*back, cells, mask, true_value, false_state);
+		}
+
+		template<region_e Region, execution_e Execution, typename U> inline void generate_packed(u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state, cref<sparse_t<bool>> spokes) noexcept {
+			if (iterations == 0) {
+				return;
+			}
+
+			const plane_type spoked{ spoke_mask<Region>(spokes) };
+
+			plane_type mask{ region_mask<Region>() };
+
+			plane_type front_plane{};
+
+			pack(front_plane, cells, true_value);
+
+			plane_type back_plane{ front_plane };
+
+			ptr<plane_type> front{ &front_plane };
+			ptr<plane_type> back{ &back_plane };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				back->exclude(spoked);
+				step_packed<Execution>(*front, *back, mask, threshold);
+				std::swap(front, back);
+			}
+
+			mask |= spoked;
+
+			unpack(*back, cells, mask, true_value, false_state);
+		}
+
+	  public:
+		// bit-packed equivalent of automatize; every cell of the region must hold either the true or false value in both the zone and the buffer
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> automatize_packed(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			if (iterations == 0) {
+				return *this;
+			}
+
+			const plane_type mask{ region_mask<Region>() };
+
+			plane_type front_plane{};
+			plane_type back_plane{};
+
+			pack(front_plane, cells, true_value);
+			pack(back_plane, buffer, true_value);
+
+			ptr<plane_type> front{ &front_plane };
+			ptr<plane_type> back{ &back_plane };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				step_packed<Execution>(*front, *back, mask, threshold);
+				std::swap(front, back);
+			}
+
+			unpack(*front, cells, mask, true_value, false_state);
+			unpack(*back, buffer, mask, true_value, false_state);
+
+			return *this;
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> automatize_packed(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize_packed<Region, Execution>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<region_e Region, execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> automatize_packed(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			if (iterations == 0) {
+				return *this;
+			}
+
+			const plane_type spoked{ spoke_mask<Region>(spokes) };
+
+			plane_type mask{ region_mask<Region>() };
+
+			plane_type front_plane{};
+			plane_type back_plane{};
+
+			pack(front_plane, cells, applicator.true_value);
+			pack(back_plane, buffer, applicator.true_value);
+
+			ptr<plane_type> front{ &front_plane };
+			ptr<plane_type> back{ &back_plane };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				back->exclude(spoked);
+				step_packed<Execution>(*front, *back, mask, threshold);
+				std::swap(front, back);
+			}
+
+			mask |= spoked;
+
+			unpack(*front, cells, mask, applicator.true_value, applicator.false_value);
+			unpack(*back, buffer, mask, applicator.true_value, applicator.false_value);
+
+			return *this;
+		}
+
+		template<extent_t Halo, typename Storage> constexpr cref<zone_t<T, Size, BorderSize, Layout>> pad(ref<padded_array_t<T, Size, Halo, Storage>> target, cref<T> sentinel) const noexcept {
+			target.fill_halo(sentinel);
+			target.assign(cells);
+
+			return *this;
+		}
+
+	  private:
+		template<region_e Region, typename U> static constexpr void modulate_padded(cref<padded_type> source, ref<padded_type> target, u8 threshold, cref<U> true_state, cref<U> false_state) noexcept {
+			constexpr extent_t::scalar_t last_row{ min(interior_extent.y, zone_extent.y) };
+			constexpr extent_t::scalar_t last_column{ min(interior_extent.x, zone_extent.x) };
+
+			const auto modulate_cell{ [&](offset_t position) {
+				const u8 neighbours{ source.neighbour_count(position, true_state) };
+
+				if (neighbours > threshold) {
+					target[position] = true_state;
+				} else if (neighbours < threshold) {
+					target[position] = false_state;
+				}
+			} };
+
 			if constexpr (Region == region_e::All) {
 				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
 					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
-						modulate(buffer, offset_t{ x, y }, threshold, applicator);
+						modulate_cell(offset_t{ x, y });
 					}
 				}
 			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, applicator);
+				for (extent_t::scalar_t y{ interior_origin.y }; y <= last_row; ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= last_column; ++x) {
+						modulate_cell(offset_t{ x, y });
 					}
 				}
 			} else if constexpr (Region == region_e::Border) {
 				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
 					if (y < interior_origin.y || y > interior_extent.y) {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							modulate(buffer, offset_t{ x, y }, threshold, applicator);
+							modulate_cell(offset_t{ x, y });
 						}
 					} else {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							modulate(buffer, offset_t{ i, y }, threshold, applicator);
-							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, applicator);
+							modulate_cell(offset_t{ i, y });
+							modulate_cell(offset_t{ zone_extent.x - i, y });
 						}
 					}
 				}
 			}
+		}
+
+	  public:
+		// halo-padded equivalent of automatize; off-edge neighbours read the true value from the ghost ring, so every cell takes the unchecked path
+		template<region_e Region, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize_padded(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == region_e::None) {
+				return *this;
+			}
+
+			if (iterations == 0) {
+				return *this;
+			}
+
+			T sentinel{};
+			sentinel = true_value;
+
+			padded_type front_array{ cells, sentinel };
+			padded_type back_array{ buffer, sentinel };
+
+			ptr<padded_type> front{ &front_array };
+			ptr<padded_type> back{ &back_array };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				modulate_padded<Region>(*front, *back, threshold, true_value, false_state);
+				std::swap(front, back);
+			}
+
+			front->extract(cells);
+			back->extract(buffer);
 
 			return *this;
 		}
 
 		template<region_e Region, typename U>
-			requires std::is_assignable<T, U>::value
-		constexpr cref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> automatize_padded(ref<array_t<T, Size, Layout>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize_padded<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		// halo-padded equivalent of collapse; off-edge neighbours read the collapsed value from the ghost ring
+		template<region_e Region, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> collapse_padded(cref<U> value, usize index, cref<U> collapse_to) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
+			T sentinel{};
+			sentinel = value;
+
+			// neighbours are read from the padded copy, so cells may collapse in place
+			const padded_type source{ cells, sentinel };
+
+			const auto collapse_cell{ [&](offset_t position) {
+				if (source[position] != value || source.melded_index(position, value) != index) {
+					return;
+				}
+
+				cells[position] = collapse_to;
+			} };
+
 			if constexpr (Region == region_e::All) {
 				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
 					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
-						modulate(buffer, offset_t{ x, y }, threshold, applicator);
+						collapse_cell(offset_t{ x, y });
 					}
 				}
 			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, applicator);
+				for (extent_t::scalar_t y{ interior_origin.y }; y <= min(interior_extent.y, zone_extent.y); ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= min(interior_extent.x, zone_extent.x); ++x) {
+						collapse_cell(offset_t{ x, y });
 					}
 				}
 			} else if constexpr (Region == region_e::Border) {
 				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
 					if (y < interior_origin.y || y > interior_extent.y) {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							modulate(buffer, offset_t{ x, y }, threshold, applicator);
+							collapse_cell(offset_t{ x, y });
 						}
 					} else {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							modulate(buffer, offset_t{ i, y }, threshold, applicator);
-							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, applicator);
+							collapse_cell(offset_t{ i, y });
+							collapse_cell(offset_t{ zone_extent.x - i, y });
 						}
 					}
 				}
@@ -1723,104 +2519,102 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+		template<region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			for (u32 i{ 0 }; i < iterations; ++i) {
-				automatize<Region>(buffer, threshold, true_value, false_state);
-				swap(buffer);
-			}
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			generate_packed<Region, execution_e::Sequential>(iterations, threshold, true_value, false_state);
 
 			return *this;
 		}
 
-		template<region_e Region, typename U>
-			requires std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+		template<region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			for (u32 i{ 0 }; i < iterations; ++i) {
-				automatize<Region>(buffer, threshold, true_value, false_state);
-				swap(buffer);
-			}
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			generate_packed<Region, execution_e::Sequential>(iterations, threshold, true_value, false_state);
 
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+		template<region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			for (u32 i{ 0 }; i < iterations; ++i) {
-				automatize<Region>(buffer, threshold, applicator);
-				swap(buffer);
-			}
+			randomize<Region>(generator, fill_percent, applicator);
+
+			generate_packed<Region, execution_e::Sequential>(iterations, threshold, applicator.true_value, applicator.false_value);
 
 			return *this;
 		}
 
-		template<region_e Region, typename U>
-			requires std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+		template<region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			for (u32 i{ 0 }; i < iterations; ++i) {
-				automatize<Region>(buffer, threshold, applicator);
-				swap(buffer);
-			}
+			randomize<Region>(generator, fill_percent, applicator);
+
+			generate_packed<Region, execution_e::Sequential>(iterations, threshold, applicator.true_value, applicator.false_value);
 
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+		template<region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			for (u32 i{ 0 }; i < iterations; ++i) {
-				spoke<Region>(buffer, applicator.false_value, spokes);
-				automatize<Region>(buffer, threshold, applicator);
-				swap(buffer);
-			}
+			randomize<Region>(generator, fill_percent, applicator, spokes);
+
+			generate_packed<Region, execution_e::Sequential>(iterations, threshold, applicator.true_value, applicator.false_value, spokes);
 
 			return *this;
 		}
 
-		template<region_e Region, typename U>
-			requires std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+		template<region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			for (u32 i{ 0 }; i < iterations; ++i) {
-				spoke<Region>(buffer, applicator.false_value, spokes);
-				automatize<Region>(buffer, threshold, applicator);
-				swap(buffer);
-			}
+			randomize<Region>(generator, fill_percent, applicator, spokes);
+
+			generate_packed<Region, execution_e::Sequential>(iterations, threshold, applicator.true_value, applicator.false_value, spokes);
 
 			return *this;
 		}
 
 		template<region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<array_t<T, Size, Layout>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, true_value, false_state);
 
-			array_t<T, Size> buffer{ cells };
+			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
@@ -1828,16 +2622,16 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<array_t<T, Size, Layout>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, true_value, false_state);
 
-			array_t<T, Size> buffer{ cells };
+			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
@@ -1845,16 +2639,16 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<array_t<T, Size, Layout>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, applicator);
 
-			array_t<T, Size> buffer{ cells };
+			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize_packed<Region>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
@@ -1862,75 +2656,66 @@ namespace bleak {
 
 		template<region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<array_t<T, Size, Layout>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, applicator);
 
-			array_t<T, Size> buffer{ cells };
+			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize_packed<Region>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer>
-			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+		template<region_e Region, execution_e Execution, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			randomize<Region>(generator, fill_percent, applicator, spokes);
-
-			array_t<T, Size> buffer{ cells };
+			randomize<Region>(generator, fill_percent, true_value, false_state);
 
-			automatize<Region>(buffer, iterations, threshold, applicator, spokes);
-			swap(buffer);
+			generate_packed<Region, Execution>(iterations, threshold, true_value, false_state);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, execution_e Execution, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
+		inline ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			randomize<Region>(generator, fill_percent, applicator, spokes);
-
-			array_t<T, Size> buffer{ cells };
+			randomize<Region>(generator, fill_percent, applicator);
 
-			automatize<Region>(buffer, iterations, threshold, applicator, spokes);
-			swap(buffer);
+			generate_packed<Region, Execution>(iterations, threshold, applicator.true_value, applicator.false_value);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer>
-			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+		template<region_e Region, execution_e Execution, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<sparse_t<bool>> spokes) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
-			randomize<Region>(generator, fill_percent, true_value, false_state);
-
-			buffer = cells;
+			randomize<Region>(generator, fill_percent, applicator, spokes);
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
-			swap(buffer);
+			generate_packed<Region, Execution>(iterations, threshold, applicator.true_value, applicator.false_value, spokes);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, execution_e Execution, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+		inline ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<array_t<T, Size, Layout>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1939,32 +2724,15 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
-			swap(buffer);
-
-			return *this;
-		}
-
-		template<region_e Region, RandomEngine Randomizer>
-			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
-			if constexpr (Region == region_e::None) {
-				return *this;
-			}
-
-			randomize<Region>(generator, fill_percent, applicator);
-
-			buffer = cells;
-
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize_packed<Region, Execution>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, execution_e Execution, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+		inline ref<zone_t<T, Size, BorderSize, Layout>> generate(ref<array_t<T, Size, Layout>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
@@ -1973,7 +2741,7 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize_packed<Region, Execution>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
@@ -2510,7 +3278,7 @@ namespace bleak {
 			}
 		}
 
-		template<region_e Region> constexpr void linear_apply(ref<array_t<T, Size>> buffer, offset_t origin, offset_t target, cref<T> value) const noexcept {
+		template<region_e Region> constexpr void linear_apply(ref<array_t<T, Size, Layout>> buffer, offset_t origin, offset_t target, cref<T> value) const noexcept {
 			if (!within<Region>(origin) || !within<Region>(target)) {
 				return;
 			}
@@ -2556,7 +3324,7 @@ namespace bleak {
 
 		template<region_e Region, typename U>
 			requires std::is_assignable<T, U>::value
-		constexpr void linear_apply(ref<array_t<T, Size>> buffer, offset_t origin, offset_t target, cref<U> value) const noexcept {
+		constexpr void linear_apply(ref<array_t<T, Size, Layout>> buffer, offset_t origin, offset_t target, cref<U> value) const noexcept {
 			if (!within<Region>(origin) || !within<Region>(target)) {
 				return;
 			}
@@ -2686,16 +3454,28 @@ namespace bleak {
 			u32 total{ 0 };
 
 			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						++total;
+				if constexpr (byte_cells) {
+					return static_cast<u32>(simd::count_equal(reinterpret_cast<cptr<u8>>(cells.data_ptr()), zone_area, std::bit_cast<u8>(value)));
+				} else {
+					for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
+						if (cells[i] == value) {
+							++total;
+						}
 					}
 				}
 			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							++total;
+				if constexpr (byte_cells) {
+					constexpr usize span{ static_cast<usize>(min(interior_extent.x, zone_extent.x) - interior_origin.x + 1) };
+
+					for (extent_t::scalar_t y{ interior_origin.y }; y <= min(interior_extent.y, zone_extent.y); ++y) {
+						total += static_cast<u32>(simd::count_equal(reinterpret_cast<cptr<u8>>(&cells[interior_origin.x, y]), span, std::bit_cast<u8>(value)));
+					}
+				} else {
+					for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+						for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+							if (cells[x, y] == value) {
+								++total;
+							}
 						}
 					}
 				}
@@ -2772,23 +3552,39 @@ namespace bleak {
 
 		template<region_e Region> constexpr u32 contains(cref<T> value) const noexcept {
 			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						return true;
+				if constexpr (byte_cells) {
+					return simd::any_equal(reinterpret_cast<cptr<u8>>(cells.data_ptr()), zone_area, std::bit_cast<u8>(value));
+				} else {
+					for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
+						if (cells[i] == value) {
+							return true;
+						}
 					}
-				}
 
-				return false;
+					return false;
+				}
 			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
+				if constexpr (byte_cells) {
+					constexpr usize span{ static_cast<usize>(min(interior_extent.x, zone_extent.x) - interior_origin.x + 1) };
+
+					for (extent_t::scalar_t y{ interior_origin.y }; y <= min(interior_extent.y, zone_extent.y); ++y) {
+						if (simd::any_equal(reinterpret_cast<cptr<u8>>(&cells[interior_origin.x, y]), span, std::bit_cast<u8>(value))) {
 							return true;
 						}
 					}
-				}
 
-				return false;
+					return false;
+				} else {
+					for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+						for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+							if (cells[x, y] == value) {
+								return true;
+							}
+						}
+					}
+
+					return false;
+				}
 			} else if constexpr (Region == region_e::Border) {
 				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
 					if (y < interior_origin.y || y > interior_extent.y) {
@@ -2964,6 +3760,114 @@ namespace bleak {
 			}
 		}
 
+	  private:
+		// evaluates queries [first, last) of a batch, walking them in order of origin so that neighbouring walks share cache lines
+		template<typename U> inline void visibility_band(std::span<const line_t> queries, usize first, usize last, cref<U> value, u32 distance, cptr<ray_table_t> table, ref<visibility_t> visibility) const noexcept {
+			std::vector<usize> order(last - first);
+
+			std::iota(order.begin(), order.end(), first);
+
+			std::sort(order.begin(), order.end(), [&](usize lhs, usize rhs) -> bool { return array_t<T, Size, Layout>::flatten(queries[lhs].start) < array_t<T, Size, Layout>::flatten(queries[rhs].start); });
+
+			for (cauto index : order) {
+				cref<line_t> query{ queries[index] };
+
+				if (cells[query.start] == value || cells[query.end] == value) {
+					continue;
+				}
+
+				const offset_t delta{ query.end - query.start };
+
+				if (table == nullptr || !table->contains(delta)) {
+					if (!linear_blockage(query.start, query.end, value, distance)) {
+						visibility.set(index);
+					}
+
+					continue;
+				}
+
+				cauto ray{ table->ray(delta) };
+
+				const usize limit{ min<usize>(distance, ray.size()) };
+
+				const bool blocked{ [&]() -> bool {
+					for (usize i{ 0 }; i < limit; ++i) {
+						if (cells[query.start + ray[i]] == value) {
+							return true;
+						}
+					}
+
+					return false;
+				}() };
+
+				if (!blocked) {
+					visibility.set(index);
+				}
+			}
+		}
+
+		// every band owns whole words of the bitset, so no two threads ever write the same word
+		template<execution_e Execution, typename U> inline visibility_t batch_visibility(std::span<const line_t> queries, cref<U> value, u32 distance, cptr<ray_table_t> table) const noexcept {
+			visibility_t visibility{ queries.size() };
+
+			if (queries.empty()) {
+				return visibility;
+			}
+
+			if constexpr (Execution == execution_e::Parallel) {
+				thread_pool_t::instance().partition(visibility_t::word_count(queries.size()), [&](usize begin, usize end) {
+					visibility_band(queries, begin * visibility_t::word_bits, min<usize>(end * visibility_t::word_bits, queries.size()), value, distance, table, visibility);
+				});
+			} else {
+				visibility_band(queries, 0, queries.size(), value, distance, table, visibility);
+			}
+
+			return visibility;
+		}
+
+	  public:
+		// batched equivalent of linear_blockage; bit i of the result is set where the end of query i is visible from its start
+		template<execution_e Execution = execution_e::Sequential> inline visibility_t linear_visibility(std::span<const line_t> queries, cref<T> value) const noexcept {
+			return batch_visibility<Execution>(queries, value, std::numeric_limits<u32>::max(), nullptr);
+		}
+
+		template<execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value
+		inline visibility_t linear_visibility(std::span<const line_t> queries, cref<U> value) const noexcept {
+			return batch_visibility<Execution>(queries, value, std::numeric_limits<u32>::max(), nullptr);
+		}
+
+		template<execution_e Execution = execution_e::Sequential> inline visibility_t linear_visibility(std::span<const line_t> queries, cref<T> value, u32 distance) const noexcept {
+			return batch_visibility<Execution>(queries, value, distance, nullptr);
+		}
+
+		template<execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value
+		inline visibility_t linear_visibility(std::span<const line_t> queries, cref<U> value, u32 distance) const noexcept {
+			return batch_visibility<Execution>(queries, value, distance, nullptr);
+		}
+
+		// queries whose delta lies within the range of the table read their walk from it rather than stepping it out
+		template<execution_e Execution = execution_e::Sequential> inline visibility_t linear_visibility(std::span<const line_t> queries, cref<T> value, cref<ray_table_t> table) const noexcept {
+			return batch_visibility<Execution>(queries, value, std::numeric_limits<u32>::max(), &table);
+		}
+
+		template<execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value
+		inline visibility_t linear_visibility(std::span<const line_t> queries, cref<U> value, cref<ray_table_t> table) const noexcept {
+			return batch_visibility<Execution>(queries, value, std::numeric_limits<u32>::max(), &table);
+		}
+
+		template<execution_e Execution = execution_e::Sequential> inline visibility_t linear_visibility(std::span<const line_t> queries, cref<T> value, u32 distance, cref<ray_table_t> table) const noexcept {
+			return batch_visibility<Execution>(queries, value, distance, &table);
+		}
+
+		template<execution_e Execution = execution_e::Sequential, typename U>
+			requires is_equatable<T, U>::value
+		inline visibility_t linear_visibility(std::span<const line_t> queries, cref<U> value, u32 distance, cref<ray_table_t> table) const noexcept {
+			return batch_visibility<Execution>(queries, value, distance, &table);
+		}
+
 		template<bool Simple = false, extent_t AtlasSize>
 		constexpr void draw(cref<atlas_t<AtlasSize>> atlas) const noexcept
 			requires is_drawable<T>::value
@@ -3093,6 +3997,7 @@ namespace bleak {
 			}
 		}
 
+		// the serialized image is the cell storage in layout order, padding included, so it only reads back into a zone of the same layout; archives and zone views check exactly that through the type
 		constexpr cstr serialize() const noexcept { return reinterpret_cast<cstr>(cells.data_ptr()); }
 
 		constexpr bool serialize(cref<std::string> path) const noexcept {
@@ -3108,5 +4013,42 @@ namespace bleak {
 		}
 
 		constexpr void deserialize(cstr binary_data) noexcept { std::memcpy(reinterpret_cast<str>(cells.data_ptr()), binary_data, cells.byte_size); }
+
+		// reads the cells straight from the current position of the stream
+		inline bool deserialize(ref<std::istream> stream) noexcept { return static_cast<bool>(stream.read(reinterpret_cast<str>(cells.data_ptr()), cells.byte_size)); }
+
+		// appends the runs of bytes in which this zone differs from the base; applying them to a copy of the base reproduces this zone
+		inline void diff(cref<zone_t<T, Size, BorderSize, Layout>> base, ref<std::vector<u8>> stream) const noexcept {
+			delta::encode(reinterpret_cast<cptr<u8>>(base.cells.data_ptr()), reinterpret_cast<cptr<u8>>(cells.data_ptr()), cells.byte_size, stream);
+		}
+
+		inline std::vector<u8> diff(cref<zone_t<T, Size, BorderSize, Layout>> base) const noexcept {
+			std::vector<u8> stream{};
+
+			diff(base, stream);
+
+			return stream;
+		}
+
+		// leaves the zone untouched and returns false if the stream is malformed or was produced by a zone of a different size
+		inline bool apply_delta(std::span<const u8> stream) noexcept { return delta::decode(stream, reinterpret_cast<ptr<u8>>(cells.data_ptr()), cells.byte_size); }
+
+		// writes the cells as a single compressed chunk of an archive
+		inline bool compress(cref<std::string> path) const noexcept {
+			return archive::write(path, archive::type_hash<zone_t<T, Size, BorderSize, Layout>>(), byte_size, 1, [&](usize) -> cptr<u8> { return reinterpret_cast<cptr<u8>>(cells.data_ptr()); });
+		}
+
+		inline bool decompress(cref<std::string> path) noexcept {
+			archive::reader_t reader{ path, archive::type_hash<zone_t<T, Size, BorderSize, Layout>>(), byte_size };
+
+			if (reader.chunk_count() != 1) {
+				return false;
+			}
+
+			return decompress(reader, 0);
+		}
+
+		// decompresses a chunk of an open archive into the cells, leaving them untouched if the chunk is corrupt
+		inline bool decompress(ref<archive::reader_t> reader, usize chunk) noexcept { return reader.read(chunk, reinterpret_cast<ptr<u8>>(cells.data_ptr())); }
 	};
 } // namespace bleak
@@ -0,0 +1,439 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#else
+	#include <fstream>
+	#include <vector>
+#endif
+
+#include <bleak/array.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/layout.hpp>
+#include <bleak/log.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// a read-only private mapping of an entire file, paged in by the kernel as it is touched; elsewhere the file is read into an owned buffer instead
+	struct mapped_file_t {
+	  private:
+		cptr<u8> address;
+		usize length;
+
+#if !defined(__linux__)
+		std::vector<u8> contents;
+#endif
+
+		inline void release() noexcept {
+#if defined(__linux__)
+			if (address != nullptr) {
+				munmap(const_cast<ptr<u8>>(address), length);
+			}
+#else
+			contents.clear();
+			contents.shrink_to_fit();
+#endif
+			address = nullptr;
+			length = 0;
+		}
+
+	  public:
+		inline mapped_file_t() noexcept :
+			address{ nullptr },
+			length{ 0 }
+#if !defined(__linux__)
+			,
+			contents{}
+#endif
+		{}
+
+		inline explicit mapped_file_t(cref<std::string> path) noexcept : mapped_file_t{} {
+#if defined(__linux__)
+			const int descriptor{ open(path.c_str(), O_RDONLY) };
+
+			if (descriptor < 0) {
+				error_log.add("[ERROR]: failed to open file for mapping!", __TIME_FILE_LINE__);
+				return;
+			}
+
+			struct stat status{};
+
+			if (fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+				error_log.add("[ERROR]: failed to determine the size of file for mapping!", __TIME_FILE_LINE__);
+				close(descriptor);
+				return;
+			}
+
+			ptr<void> mapping{ mmap(nullptr, static_cast<usize>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0) };
+
+			close(descriptor);
+
+			if (mapping == MAP_FAILED) {
+				error_log.add("[ERROR]: failed to map file!", __TIME_FILE_LINE__);
+				return;
+			}
+
+			address = static_cast<cptr<u8>>(mapping);
+			length = static_cast<usize>(status.st_size);
+#else
+			std::ifstream file{};
+
+			file.open(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+			if (!file.is_open()) {
+				error_log.add("[ERROR]: failed to open file for mapping!", __TIME_FILE_LINE__);
+				return;
+			}
+
+			contents.resize(static_cast<usize>(file.tellg()));
+
+			file.seekg(0, std::ios::beg);
+
+			if (!file.read(reinterpret_cast<str>(contents.data()), static_cast<std::streamsize>(contents.size()))) {
+				error_log.add("[ERROR]: failed to read file for mapping!", __TIME_FILE_LINE__);
+				contents.clear();
+				return;
+			}
+
+			address = contents.data();
+			length = contents.size();
+#endif
+		}
+
+		inline mapped_file_t(cref<mapped_file_t> other) noexcept = delete;
+
+		inline mapped_file_t(rval<mapped_file_t> other) noexcept :
+			address{ std::exchange(other.address, nullptr) },
+			length{ std::exchange(other.length, 0) }
+#if !defined(__linux__)
+			,
+			contents{ std::move(other.contents) }
+#endif
+		{}
+
+		inline ref<mapped_file_t> operator=(cref<mapped_file_t> other) noexcept = delete;
+
+		inline ref<mapped_file_t> operator=(rval<mapped_file_t> other) noexcept {
+			if (this != &other) {
+				release();
+
+				address = std::exchange(other.address, nullptr);
+				length = std::exchange(other.length, 0);
+#if !defined(__linux__)
+				contents = std::move(other.contents);
+#endif
+			}
+
+			return *this;
+		}
+
+		inline ~mapped_file_t() noexcept { release(); }
+
+		constexpr bool empty() const noexcept { return address == nullptr; }
+
+		constexpr usize size() const noexcept { return length; }
+
+		constexpr cptr<u8> data() const noexcept { return address; }
+	};
+
+	// a read-only zone that reads the cells of a serialized zone or region file in place, so that nothing is copied before the first lookup; the file must have been written from the same zone type.
+	// the image is the cell storage in layout order, so lookups index it through the layout rather than through a zone object.
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero, typename Layout = row_major_layout_t> struct zone_view_t {
+	  public:
+		using zone_type = zone_t<T, Size, BorderSize, Layout>;
+		using array_type = array_t<T, Size, Layout>;
+
+		static_assert(std::is_trivially_copyable<T>::value, "zone view requires trivially copyable cells!");
+
+		static constexpr extent_t zone_size{ zone_type::zone_size };
+		static constexpr extent_t border_size{ zone_type::border_size };
+
+		static constexpr offset_t zone_origin{ zone_type::zone_origin };
+		static constexpr offset_t zone_extent{ zone_type::zone_extent };
+
+		static constexpr offset_t interior_origin{ zone_type::interior_origin };
+		static constexpr offset_t interior_extent{ zone_type::interior_extent };
+
+		static constexpr extent_t::product_t zone_area{ zone_type::zone_area };
+
+	  private:
+		mapped_file_t file;
+
+		cptr<T> cells;
+
+		constexpr cardinal_t edge_state(offset_t position) const noexcept {
+			cardinal_t state{ cardinal_e::Central };
+
+			if (position.x == zone_origin.x) {
+				state += cardinal_e::West;
+			} else if (position.x == zone_extent.x) {
+				state += cardinal_e::East;
+			}
+
+			if (position.y == zone_origin.y) {
+				state += cardinal_e::North;
+			} else if (position.y == zone_extent.y) {
+				state += cardinal_e::South;
+			}
+
+			return state;
+		}
+
+		template<bool Simple, extent_t AtlasSize, typename... Args> constexpr void draw_cells(cref<atlas_t<AtlasSize>> atlas, offset_t origin, extent_t extent, Args... args) const noexcept {
+			if (extent.w == 0 || extent.h == 0 || origin.x > zone_extent.x || origin.y > zone_extent.y) {
+				return;
+			}
+
+			for (offset_t::scalar_t y{ max(offset_t::scalar_t{ 0 }, origin.y) }; y < min(zone_size.h, extent.h); ++y) {
+				for (offset_t::scalar_t x{ max(offset_t::scalar_t{ 0 }, origin.x) }; x < min(zone_size.w, extent.w); ++x) {
+					const offset_t pos{ x, y };
+
+					if constexpr (Simple) {
+						(*this)[pos].draw(atlas, pos, args...);
+					} else {
+						(*this)[pos].draw(atlas, *this, pos, args...);
+					}
+				}
+			}
+		}
+
+	  public:
+		inline zone_view_t() noexcept : file{}, cells{ nullptr } {}
+
+		// the index selects a zone within a serialized region, which stores its zones back to back
+		inline explicit zone_view_t(cref<std::string> path, usize index = 0) noexcept : file{ path }, cells{ nullptr } {
+			if (file.empty()) {
+				return;
+			}
+
+			if (file.size() < (index + 1) * zone_type::byte_size) {
+				error_log.add("[ERROR]: byte size mismatch between file and zone view!", __TIME_FILE_LINE__);
+				return;
+			}
+
+			cptr<u8> image{ file.data() + index * zone_type::byte_size };
+
+#if defined(__cpp_lib_start_lifetime_as)
+			cells = std::start_lifetime_as_array<T>(image, array_type::capacity);
+#else
+			cells = reinterpret_cast<cptr<T>>(image);
+#endif
+		}
+
+		inline zone_view_t(cref<zone_view_t> other) noexcept = delete;
+
+		inline zone_view_t(rval<zone_view_t> other) noexcept : file{ std::move(other.file) }, cells{ std::exchange(other.cells, nullptr) } {}
+
+		inline ref<zone_view_t> operator=(cref<zone_view_t> other) noexcept = delete;
+
+		inline ref<zone_view_t> operator=(rval<zone_view_t> other) noexcept {
+			if (this != &other) {
+				file = std::move(other.file);
+				cells = std::exchange(other.cells, nullptr);
+			}
+
+			return *this;
+		}
+
+		inline ~zone_view_t() noexcept {}
+
+		constexpr bool is_valid() const noexcept { return cells != nullptr; }
+
+		constexpr cref<T> operator[](extent_t::product_t index) const noexcept { return cells[array_type::linearize(static_cast<usize>(index))]; }
+
+		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return cells[array_type::flatten(x, y)]; }
+
+		constexpr cref<T> operator[](offset_t position) const noexcept { return cells[array_type::flatten(position)]; }
+
+		// copies the viewed cells into a zone for the parts of its api the view does not provide
+		constexpr void copy_to(ref<zone_type> zone) const noexcept { zone.deserialize(reinterpret_cast<cstr>(cells)); }
+
+		template<region_e Region> constexpr bool within(offset_t position) const noexcept {
+			if constexpr (Region == region_e::All) {
+				if constexpr (array_type::contiguous_rows) {
+					return between<offset_t::product_t>(array_type::flatten(position), 0, array_type::area);
+				} else {
+					return position.x >= 0 && position.x < zone_size.w && position.y >= 0 && position.y < zone_size.h;
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				return position.x >= interior_origin.x && position.x <= interior_extent.x && position.y >= interior_origin.y && position.y <= interior_extent.y;
+			} else if constexpr (Region == region_e::Border) {
+				return position.x < interior_origin.x || position.x > interior_extent.x || position.y < interior_origin.y || position.y > interior_extent.y;
+			}
+
+			return false;
+		}
+
+		template<region_e Region, typename U>
+			requires is_equatable<T, U>::value
+		constexpr u32 count(cref<U> value) const noexcept {
+			u32 total{ 0 };
+
+			if constexpr (Region == region_e::All) {
+				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
+					if ((*this)[i] == value) {
+						++total;
+					}
+				}
+			} else if constexpr (Region == region_e::Interior) {
+				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+						if ((*this)[x, y] == value) {
+							++total;
+						}
+					}
+				}
+			} else if constexpr (Region == region_e::Border) {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+							if ((*this)[x, y] == value) {
+								++total;
+							}
+						}
+					} else {
+						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
+							if ((*this)[i, y] == value) {
+								++total;
+							}
+							if ((*this)[zone_extent.x - i, y] == value) {
+								++total;
+							}
+						}
+					}
+				}
+			}
+
+			return total;
+		}
+
+		template<bool Safe = false, typename U>
+			requires is_equatable<T, U>::value
+		constexpr u8 neighbour_count(offset_t position, cref<U> value) const noexcept {
+			const cardinal_t edge{ Safe ? cardinal_t{ cardinal_e::Central } : edge_state(position) };
+
+			return static_cast<u8>(
+				(edge.north || edge.west || (*this)[position + offset_t::Northwest] == value) +
+				(edge.north || (*this)[position + offset_t::North] == value) +
+				(edge.north || edge.east || (*this)[position + offset_t::Northeast] == value) +
+				(edge.west || (*this)[position + offset_t::West] == value) +
+				(edge.east || (*this)[position + offset_t::East] == value) +
+				(edge.south || edge.west || (*this)[position + offset_t::Southwest] == value) +
+				(edge.south || (*this)[position + offset_t::South] == value) +
+				(edge.south || edge.east || (*this)[position + offset_t::Southeast] == value)
+			);
+		}
+
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr bool linear_blockage(offset_t origin, offset_t target, cref<U> value) const noexcept { return linear_blockage(origin, target, value, std::numeric_limits<u32>::max()); }
+
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr bool linear_blockage(offset_t origin, offset_t target, cref<U> value, u32 distance) const noexcept {
+			if ((*this)[origin] == value || (*this)[target] == value) {
+				return true;
+			}
+
+			if (origin == target) {
+				return false;
+			}
+
+			offset_t delta{ std::abs(target.x - origin.x), std::abs(target.y - origin.y) };
+
+			offset_t step{ origin.x < target.x ? 1 : -1, origin.y < target.y ? 1 : -1 };
+
+			i32 err = delta.x - delta.y;
+
+			creeper_t<u32> creeper{ origin, 0 };
+
+			for (;;) {
+				if (creeper.position == target) {
+					return false;
+				}
+
+				if ((*this)[creeper.position] == value) {
+					return true;
+				}
+
+				i32 e2 = 2 * err;
+
+				if (e2 > -delta.y || e2 < delta.x) {
+					if (creeper.distance >= distance) {
+						return false;
+					}
+
+					if (e2 > -delta.y) {
+						err -= delta.y;
+						creeper.position.x += step.x;
+					}
+
+					if (e2 < delta.x) {
+						err += delta.x;
+						creeper.position.y += step.y;
+					}
+
+					++creeper.distance;
+				}
+			}
+		}
+
+		// cells that draw against their surroundings are handed the view in place of a zone
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas) const noexcept
+			requires is_drawable<T>::value
+		{
+			draw_cells<Simple>(atlas, zone_origin, zone_size);
+		}
+
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, offset_t offset) const noexcept
+			requires is_drawable<T>::value
+		{
+			draw_cells<Simple>(atlas, zone_origin, zone_size, offset);
+		}
+
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera) const noexcept
+			requires is_drawable<T>::value
+		{
+			draw_cells<Simple>(atlas, camera.get_position(), camera.get_extent(), -camera.get_position());
+		}
+
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset) const noexcept
+			requires is_drawable<T>::value
+		{
+			draw_cells<Simple>(atlas, camera.get_position(), camera.get_extent(), -camera.get_position() + offset);
+		}
+
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset, offset_t nudge) const noexcept
+			requires is_drawable<T>::value
+		{
+			draw_cells<Simple>(atlas, camera.get_position(), camera.get_extent(), -camera.get_position() + offset, nudge);
+		}
+
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, offset_t offset, offset_t origin, extent_t size) const noexcept
+			requires is_drawable<T>::value
+		{
+			draw_cells<Simple>(atlas, origin, extent_t{ origin + size }, offset);
+		}
+	};
+} // namespace bleak